@@ -27,6 +27,7 @@ constexpr auto printReply(const Reply &reply, unsigned long &databaseIndex, bool
             std::println(R"("{}")", reply.getString());
             break;
         case Reply::Type::array:
+        case Reply::Type::map:
             const std::span replies{reply.getArray()};
             if (!replies.empty()) {
                 for (unsigned long i{}; i != replies.size(); ++i) {
@@ -60,7 +61,7 @@ auto main() -> int {
         if (input.empty()) continue;
         if (input == "QUIT") break;
 
-        connection.send(Answer{std::move(input)}.serialize());
+        connection.send(Answer{input}.serialize());
 
         printReply(Reply{connection.receive()}, databaseIndex, isTransaction, std::string{});
     }
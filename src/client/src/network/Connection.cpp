@@ -82,19 +82,21 @@ auto Connection::send(const std::span<const std::byte> data, const std::source_l
 }
 
 auto Connection::receive(const std::source_location sourceLocation) const -> std::vector<std::byte> {
-    std::vector<std::byte> buffer;
+    unsigned long size;
+    this->receive(std::as_writable_bytes(std::span{&size, 1}), sourceLocation);
 
-    while (true) {
-        std::vector<std::byte> subBuffer{1024};
+    std::vector<std::byte> buffer{size};
+    this->receive(buffer, sourceLocation);
 
-        if (const long result{
-                recv(this->fileDescriptor, subBuffer.data(), subBuffer.size(), !buffer.empty() ? MSG_DONTWAIT : 0)};
-            result > 0) {
-            subBuffer.resize(result);
-            buffer.insert(buffer.cend(), subBuffer.cbegin(), subBuffer.cend());
-        } else {
-            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) break;
+    return buffer;
+}
 
+auto Connection::receive(std::span<std::byte> buffer, const std::source_location sourceLocation) const -> void {
+    while (!buffer.empty()) {
+        if (const long result{recv(this->fileDescriptor, buffer.data(), buffer.size(), MSG_WAITALL)}; result > 0)
+            buffer = buffer.subspan(result);
+        else if (result == -1 && errno == EINTR) continue;
+        else {
             throw Exception{
                 Log{Log::Level::fatal,
                     result == 0 ? "connection closed" : std::error_code{errno, std::generic_category()}.message(),
@@ -102,6 +104,4 @@ auto Connection::receive(const std::source_location sourceLocation) const -> std
             };
         }
     }
-
-    return buffer;
 }
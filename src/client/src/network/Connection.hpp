@@ -26,6 +26,8 @@ public:
         -> std::vector<std::byte>;
 
 private:
+    auto receive(std::span<std::byte> buffer, std::source_location sourceLocation) const -> void;
+
     auto close(std::source_location sourceLocation = std::source_location::current()) const -> void;
 
     int fileDescriptor;
@@ -1,18 +1,82 @@
 #include "Answer.hpp"
 
-Answer::Answer(std::string &&statement) noexcept : statement{std::move(statement)} {}
+#include <algorithm>
+#include <cstring>
+#include <ranges>
 
-Answer::Answer(const std::span<const std::byte> data) {
-    this->statement = std::string{reinterpret_cast<const char *>(data.data()), data.size()};
+auto Answer::isKeyword(const std::string_view argument, const std::string_view keyword) noexcept -> bool {
+    return std::ranges::equal(argument, keyword, [](const char left, const char right) noexcept {
+        return (left >= 'a' && left <= 'z' ? static_cast<char>(left - 'a' + 'A') : left) == right;
+    });
+}
+
+Answer::Answer(const std::string_view statement) {
+    std::vector<std::string_view> arguments;
+    for (const auto &view : statement | std::views::split(' ')) {
+        if (!view.empty()) arguments.emplace_back(view);
+    }
+
+    this->assign(arguments);
+}
+
+Answer::Answer(const std::span<const std::string_view> arguments) { this->assign(arguments); }
+
+Answer::Answer(std::span<const std::byte> data) {
+    std::vector<std::string_view> arguments;
+    while (data.size() >= sizeof(unsigned long)) {
+        unsigned long size;
+        std::memcpy(&size, data.data(), sizeof(size));
+        data = data.subspan(sizeof(size));
+        if (size > data.size()) break;
+
+        arguments.emplace_back(reinterpret_cast<const char *>(data.data()), size);
+        data = data.subspan(size);
+    }
+
+    this->assign(arguments);
 }
 
 auto Answer::serialize() const -> std::vector<std::byte> {
-    std::vector<std::byte> serialization;
+    std::vector<std::byte> serialization{sizeof(unsigned long)};
+
+    for (const std::string_view argument : this->arguments) {
+        const unsigned long size{argument.size()};
+        const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
+        serialization.insert(serialization.cend(), sizeBytes.cbegin(), sizeBytes.cend());
 
-    const auto bytes{std::as_bytes(std::span{this->statement})};
-    serialization.insert(serialization.cend(), bytes.cbegin(), bytes.cend());
+        const auto bytes{std::as_bytes(std::span{argument})};
+        serialization.insert(serialization.cend(), bytes.cbegin(), bytes.cend());
+    }
+
+    *reinterpret_cast<unsigned long *>(serialization.data()) = serialization.size() - sizeof(unsigned long);
 
     return serialization;
 }
 
-auto Answer::getStatement() const noexcept -> std::string_view { return this->statement; }
+auto Answer::getCommand() const noexcept -> std::string_view {
+    return this->arguments.empty() ? std::string_view{} : this->arguments.front();
+}
+
+auto Answer::getArguments() const noexcept -> std::span<const std::string_view> {
+    return this->arguments.empty() ? std::span<const std::string_view>{} : std::span{this->arguments}.subspan(1);
+}
+
+auto Answer::assign(const std::span<const std::string_view> arguments) -> void {
+    unsigned long size{};
+    for (const std::string_view argument : arguments) size += argument.size();
+    this->buffer.reserve(size);
+
+    for (const std::string_view argument : arguments)
+        this->buffer.insert(this->buffer.cend(), argument.cbegin(), argument.cend());
+
+    if (!arguments.empty()) {
+        for (char &letter : std::span{this->buffer}.first(arguments.front().size()))
+            if (letter >= 'a' && letter <= 'z') letter = static_cast<char>(letter - 'a' + 'A');
+    }
+
+    this->arguments.reserve(arguments.size());
+    for (unsigned long offset{}; const std::string_view argument : arguments) {
+        this->arguments.emplace_back(this->buffer.data() + offset, argument.size());
+        offset += argument.size();
+    }
+}
@@ -6,14 +6,35 @@
 
 class Answer {
 public:
-    explicit Answer(std::string &&statement) noexcept;
+    [[nodiscard]] static auto isKeyword(std::string_view argument, std::string_view keyword) noexcept -> bool;
+
+    Answer() = default;
+
+    explicit Answer(std::string_view statement);
+
+    explicit Answer(std::span<const std::string_view> arguments);
 
     explicit Answer(std::span<const std::byte> data);
 
+    Answer(const Answer &) = delete;
+
+    Answer(Answer &&) noexcept = default;
+
+    auto operator=(const Answer &) -> Answer & = delete;
+
+    auto operator=(Answer &&) noexcept -> Answer & = default;
+
+    ~Answer() = default;
+
     [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
 
-    [[nodiscard]] auto getStatement() const noexcept -> std::string_view;
+    [[nodiscard]] auto getCommand() const noexcept -> std::string_view;
+
+    [[nodiscard]] auto getArguments() const noexcept -> std::span<const std::string_view>;
 
 private:
-    std::string statement;
+    auto assign(std::span<const std::string_view> arguments) -> void;
+
+    std::vector<char> buffer;
+    std::vector<std::string_view> arguments;
 };
@@ -26,13 +26,14 @@ Reply::Reply(std::span<const std::byte> data) {
             this->deserializeString(data);
             break;
         case Type::array:
+        case Type::map:
             this->deserializeArray(data);
             break;
     }
 }
 
 auto Reply::serialize() const -> std::vector<std::byte> {
-    std::vector<std::byte> serialization;
+    std::vector<std::byte> serialization{sizeof(unsigned long)};
 
     const auto databaseIndexBytes{std::as_bytes(std::span{&this->databaseIndex, 1})};
     serialization.insert(serialization.cend(), databaseIndexBytes.cbegin(), databaseIndexBytes.cend());
@@ -56,11 +57,14 @@ auto Reply::serialize() const -> std::vector<std::byte> {
             serializedValue = this->serializeString();
             break;
         case Type::array:
+        case Type::map:
             serializedValue = this->serializeArray();
             break;
     }
     serialization.insert(serialization.cend(), serializedValue.cbegin(), serializedValue.cend());
 
+    *reinterpret_cast<unsigned long *>(serialization.data()) = serialization.size() - sizeof(unsigned long);
+
     return serialization;
 }
 
@@ -98,11 +102,6 @@ auto Reply::serializeArray() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
     for (const auto &reply : std::get<std::vector<Reply>>(this->value)) {
         const std::vector serializedReply{reply.serialize()};
-
-        const unsigned long size{serializedReply.size()};
-        const auto bytes{std::as_bytes(std::span{&size, 1})};
-        serialization.insert(serialization.cend(), bytes.cbegin(), bytes.cend());
-
         serialization.insert(serialization.cend(), serializedReply.cbegin(), serializedReply.cend());
     }
 
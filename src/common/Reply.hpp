@@ -7,7 +7,7 @@
 
 class Reply {
 public:
-    enum class Type : unsigned char { nil, integer, error, status, string, array };
+    enum class Type : unsigned char { nil, integer, error, status, string, array, map };
 
     Reply(Type type, std::variant<long, std::string, std::vector<Reply>> &&value, unsigned long databaseIndex = {},
           bool isTransaction = {}) noexcept;
@@ -0,0 +1,78 @@
+#include "Configuration.hpp"
+
+#include "../../../common/Exception.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+auto Configuration::load(const std::string_view filepath, const std::source_location sourceLocation)
+    -> Configuration {
+    Configuration configuration;
+
+    std::ifstream file{filepath.data()};
+    if (!file.is_open()) return configuration;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        const std::string_view view{line};
+        if (view.empty() || view.front() == '#') continue;
+
+        const unsigned long space{view.find(' ')};
+        const auto key{view.substr(0, space)};
+        const std::string value{space != std::string_view::npos ? view.substr(space + 1) : std::string_view{}};
+
+        try {
+            if (key == "zero-copy-threshold") configuration.zeroCopyThreshold = std::stoul(value);
+            else if (key == "fixed-buffer-size") configuration.fixedBufferSize = std::stoul(value);
+            else if (key == "fixed-buffer-count") configuration.fixedBufferCount = std::stoul(value);
+            else if (key == "small-receive-buffer-size") configuration.smallReceiveBufferSize = std::stoul(value);
+            else if (key == "small-receive-buffer-count") configuration.smallReceiveBufferCount = std::stoul(value);
+            else if (key == "large-receive-buffer-size") configuration.largeReceiveBufferSize = std::stoul(value);
+            else if (key == "large-receive-buffer-count") configuration.largeReceiveBufferCount = std::stoul(value);
+            else if (key == "query-buffer-soft-limit") configuration.querySoftLimit = std::stoul(value);
+            else if (key == "query-buffer-hard-limit") configuration.queryHardLimit = std::stoul(value);
+            else if (key == "output-buffer-soft-limit") configuration.outputSoftLimit = std::stoul(value);
+            else if (key == "output-buffer-hard-limit") configuration.outputHardLimit = std::stoul(value);
+            else if (key == "idle-timeout") configuration.idleTimeout = std::stoul(value);
+            else if (key == "send-timeout") configuration.sendTimeout = std::stoul(value);
+            else if (key == "shards") configuration.shardCount = std::max(std::stoul(value), 1UL);
+            else if (key == "polling") {
+                if (value == "none") configuration.polling = Polling::none;
+                else if (value == "sqpoll") configuration.polling = Polling::sqpoll;
+                else if (value == "spin") configuration.polling = Polling::spin;
+                else throw std::invalid_argument{"unknown polling mode"};
+            } else if (key == "sqpoll-shared") {
+                if (value == "yes") configuration.isSqpollShared = true;
+                else if (value == "no") configuration.isSqpollShared = false;
+                else throw std::invalid_argument{"unknown sqpoll-shared value"};
+            } else if (key == "sqpoll-idle") configuration.sqpollIdle = std::stoul(value);
+            else if (key == "spin-time") configuration.spinTime = std::stoul(value);
+            else if (key == "batch-size") configuration.batchSize = std::max(std::stoul(value), 1UL);
+            else if (key == "batch-wait") configuration.batchWait = std::stoul(value);
+            else if (key == "offload-threads") configuration.offloadThreadCount = std::stoul(value);
+            else if (key == "offload-threshold") configuration.offloadThreshold = std::stoul(value);
+            else if (key == "client-command-budget") configuration.clientCommandBudget = std::stoul(value);
+            else if (key == "client-byte-budget") configuration.clientByteBudget = std::stoul(value);
+            else if (key == "shed-threshold") configuration.shedThreshold = std::stoul(value);
+            else if (key == "persistence-rate") configuration.persistenceRate = std::stoul(value);
+            else if (key == "persistence-chunk-size")
+                configuration.persistenceChunkSize = std::max(std::stoul(value), 1UL);
+            else if (key == "migration-threshold") configuration.migrationThreshold = std::stoul(value);
+            else if (key == "listpack-max-entries") configuration.listPackMaxEntries = std::stoul(value);
+            else if (key == "listpack-max-value") configuration.listPackMaxValue = std::stoul(value);
+            else if (key == "submission-queue-entries")
+                configuration.submissionQueueEntries = std::max(std::stoul(value), 1UL);
+            else if (key == "completion-queue-entries")
+                configuration.completionQueueEntries = std::max(std::stoul(value), 1UL);
+            else throw std::invalid_argument{"unknown configuration"};
+        } catch (const std::logic_error &) {
+            throw Exception{
+                Log{Log::Level::fatal, "invalid configuration: " + line, sourceLocation}
+            };
+        }
+    }
+
+    return configuration;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <source_location>
+#include <string_view>
+
+struct Configuration {
+    enum class Polling : unsigned char { none, sqpoll, spin };
+
+    [[nodiscard]] static auto load(std::string_view filepath,
+                                   std::source_location sourceLocation = std::source_location::current())
+        -> Configuration;
+
+    unsigned long zeroCopyThreshold{16 * 1024}, fixedBufferSize{64 * 1024}, smallReceiveBufferSize{1024},
+        largeReceiveBufferSize{32 * 1024}, querySoftLimit{16 * 1024 * 1024}, queryHardLimit{1024 * 1024 * 1024},
+        outputSoftLimit{16 * 1024 * 1024}, outputHardLimit{256 * 1024 * 1024};
+    unsigned long idleTimeout{300}, sendTimeout{10}, shardCount{1};
+    unsigned long sqpollIdle{1000}, spinTime{50}, batchWait{50}, offloadThreadCount{}, offloadThreshold{10000};
+    unsigned long clientCommandBudget{1024}, clientByteBudget{}, shedThreshold{};
+    unsigned long persistenceRate{}, persistenceChunkSize{256 * 1024}, migrationThreshold{};
+    unsigned long listPackMaxEntries{128}, listPackMaxValue{64};
+    Polling polling{Polling::none};
+    bool isSqpollShared{};
+    unsigned int fixedBufferCount{4}, smallReceiveBufferCount{1024}, largeReceiveBufferCount{64}, batchSize{1},
+        submissionQueueEntries{256}, completionQueueEntries{4096};
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "FramePool.hpp"
+#include "Task.hpp"
+
+#include <exception>
+#include <optional>
+#include <utility>
+
+template<typename T>
+class AsyncResult {
+public:
+    auto return_value(T value) -> void { this->value.emplace(std::move(value)); }
+
+    [[nodiscard]] auto getValue() -> T { return std::move(*this->value); }
+
+private:
+    std::optional<T> value;
+};
+
+template<>
+class AsyncResult<void> {
+public:
+    constexpr auto return_void() const noexcept -> void {}
+
+    constexpr auto getValue() const noexcept -> void {}
+};
+
+template<typename T = void>
+class AsyncTask {
+public:
+    class promise_type : public AsyncResult<T> {
+        struct FinalAwaiter {
+            [[nodiscard]] constexpr auto await_ready() const noexcept { return false; }
+
+            [[nodiscard]] auto await_suspend(const std::coroutine_handle<promise_type> handle) const noexcept
+                -> std::coroutine_handle<> {
+                return handle.promise().continuation;
+            }
+
+            constexpr auto await_resume() const noexcept -> void {}
+        };
+
+    public:
+        [[nodiscard]] static auto operator new(const std::size_t size) -> void * {
+            return FramePool::get().allocate(size);
+        }
+
+        static auto operator delete(void *const pointer, const std::size_t size) noexcept -> void {
+            FramePool::get().deallocate(pointer, size);
+        }
+
+        [[nodiscard]] auto get_return_object() -> AsyncTask {
+            return AsyncTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        [[nodiscard]] constexpr auto initial_suspend() const noexcept { return std::suspend_always{}; }
+
+        [[nodiscard]] constexpr auto final_suspend() const noexcept { return FinalAwaiter{}; }
+
+        auto unhandled_exception() noexcept -> void { this->exception = std::current_exception(); }
+
+        [[nodiscard]] auto getRoot() const noexcept -> Task::promise_type & { return *this->root; }
+
+        auto setCaller(const std::coroutine_handle<> continuation, Task::promise_type &root) noexcept -> void {
+            this->continuation = continuation;
+            this->root = &root;
+        }
+
+        auto rethrow() const -> void {
+            if (this->exception) std::rethrow_exception(this->exception);
+        }
+
+    private:
+        std::coroutine_handle<> continuation;
+        Task::promise_type *root{};
+        std::exception_ptr exception;
+    };
+
+    explicit AsyncTask(const std::coroutine_handle<promise_type> handle) noexcept : handle{handle} {}
+
+    AsyncTask(const AsyncTask &) = delete;
+
+    AsyncTask(AsyncTask &&other) noexcept : handle{std::exchange(other.handle, nullptr)} {}
+
+    auto operator=(const AsyncTask &) -> AsyncTask & = delete;
+
+    auto operator=(AsyncTask &&other) noexcept -> AsyncTask & {
+        if (this == &other) return *this;
+
+        this->destroy();
+
+        this->handle = std::exchange(other.handle, nullptr);
+
+        return *this;
+    }
+
+    ~AsyncTask() { this->destroy(); }
+
+    [[nodiscard]] constexpr auto await_ready() const noexcept { return false; }
+
+    template<typename Promise>
+    [[nodiscard]] auto await_suspend(const std::coroutine_handle<Promise> caller) const noexcept
+        -> std::coroutine_handle<> {
+        this->handle.promise().setCaller(caller, caller.promise().getRoot());
+
+        return this->handle;
+    }
+
+    auto await_resume() const -> T {
+        this->handle.promise().rethrow();
+
+        return this->handle.promise().getValue();
+    }
+
+private:
+    auto destroy() const -> void {
+        if (this->handle) this->handle.destroy();
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
@@ -8,11 +8,15 @@ public:
 
     [[nodiscard]] constexpr auto await_ready() const noexcept { return false; }
 
-    auto await_suspend(std::coroutine_handle<Task::promise_type> handle) -> void;
+    template<typename Promise>
+    auto await_suspend(const std::coroutine_handle<Promise> handle) -> void {
+        this->promise = &handle.promise().getRoot();
+        this->promise->setSubmission(this->submission, handle);
+    }
 
     [[nodiscard]] auto await_resume() const -> Outcome;
 
 private:
-    std::coroutine_handle<Task::promise_type> handle;
+    Task::promise_type *promise{};
     Submission submission;
 };
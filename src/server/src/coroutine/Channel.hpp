@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Task.hpp"
+
+#include <coroutine>
+#include <optional>
+#include <queue>
+#include <utility>
+
+template<typename T>
+class Channel {
+public:
+    class Receiver {
+    public:
+        explicit Receiver(Channel &channel) noexcept : channel{channel} {}
+
+        [[nodiscard]] auto await_ready() -> bool {
+            if (this->channel.values.empty()) return false;
+
+            this->value.emplace(std::move(this->channel.values.front()));
+            this->channel.values.pop();
+
+            return true;
+        }
+
+        template<typename Promise>
+        auto await_suspend(const std::coroutine_handle<Promise> handle) -> void {
+            this->promise = &handle.promise().getRoot();
+            this->promise->setLeaf(handle);
+
+            this->channel.receivers.emplace(this);
+        }
+
+        [[nodiscard]] auto await_resume() -> T { return std::move(*this->value); }
+
+    private:
+        friend class Channel;
+
+        Channel &channel;
+        Task::promise_type *promise{};
+        std::optional<T> value;
+    };
+
+    Channel() = default;
+
+    Channel(const Channel &) = delete;
+
+    Channel(Channel &&) noexcept = delete;
+
+    auto operator=(const Channel &) -> Channel & = delete;
+
+    auto operator=(Channel &&) noexcept -> Channel & = delete;
+
+    ~Channel() = default;
+
+    [[nodiscard]] auto receive() noexcept -> Receiver { return Receiver{*this}; }
+
+    auto send(T value) -> void {
+        if (this->receivers.empty()) {
+            this->values.emplace(std::move(value));
+
+            return;
+        }
+
+        Receiver *const receiver{this->receivers.front()};
+        this->receivers.pop();
+
+        receiver->value.emplace(std::move(value));
+        receiver->promise->wake();
+    }
+
+private:
+    std::queue<T> values;
+    std::queue<Receiver *> receivers;
+};
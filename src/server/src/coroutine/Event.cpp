@@ -0,0 +1,19 @@
+#include "Event.hpp"
+
+#include <utility>
+
+Event::Waiter::Waiter(Event &event) noexcept : event{event} {}
+
+auto Event::Waiter::await_ready() const noexcept -> bool { return this->event.isSet; }
+
+auto Event::wait() noexcept -> Waiter { return Waiter{*this}; }
+
+auto Event::getIsSet() const noexcept -> bool { return this->isSet; }
+
+auto Event::set() -> void {
+    this->isSet = true;
+
+    for (Task::promise_type *const promise : std::exchange(this->waiters, {})) promise->wake();
+}
+
+auto Event::reset() noexcept -> void { this->isSet = false; }
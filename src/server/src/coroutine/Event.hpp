@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Task.hpp"
+
+#include <coroutine>
+#include <vector>
+
+class Event {
+public:
+    class Waiter {
+    public:
+        explicit Waiter(Event &event) noexcept;
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool;
+
+        template<typename Promise>
+        auto await_suspend(const std::coroutine_handle<Promise> handle) const -> void {
+            Task::promise_type &promise{handle.promise().getRoot()};
+            promise.setLeaf(handle);
+
+            this->event.waiters.emplace_back(&promise);
+        }
+
+        constexpr auto await_resume() const noexcept -> void {}
+
+    private:
+        Event &event;
+    };
+
+    constexpr Event() noexcept = default;
+
+    Event(const Event &) = delete;
+
+    Event(Event &&) noexcept = delete;
+
+    auto operator=(const Event &) -> Event & = delete;
+
+    auto operator=(Event &&) noexcept -> Event & = delete;
+
+    ~Event() = default;
+
+    [[nodiscard]] auto wait() noexcept -> Waiter;
+
+    [[nodiscard]] auto getIsSet() const noexcept -> bool;
+
+    auto set() -> void;
+
+    auto reset() noexcept -> void;
+
+private:
+    std::vector<Task::promise_type *> waiters;
+    bool isSet{};
+};
@@ -0,0 +1,69 @@
+#include "FramePool.hpp"
+
+#include "../statistics/Statistics.hpp"
+
+#include <new>
+
+auto FramePool::get() -> FramePool & {
+    thread_local FramePool framePool;
+
+    return framePool;
+}
+
+FramePool::~FramePool() {
+    for (const Block *block : this->freeLists) {
+        while (block != nullptr) {
+            const Block *const next{block->next};
+            ::operator delete(const_cast<Block *>(block));
+            block = next;
+        }
+    }
+}
+
+auto FramePool::allocate(const unsigned long size) -> void * {
+    if (++this->allocatedCount > this->highWater) this->highWater = this->allocatedCount;
+
+    const unsigned long sizeClass{getSizeClass(size)};
+    if (sizeClass >= this->freeLists.size()) {
+        ++this->missCount;
+
+        return ::operator new(size);
+    }
+
+    if (Block *const block{this->freeLists[sizeClass]}; block != nullptr) {
+        this->freeLists[sizeClass] = block->next;
+        ++this->hitCount;
+
+        return block;
+    }
+
+    ++this->missCount;
+
+    return ::operator new((sizeClass + 1) * granularity);
+}
+
+auto FramePool::deallocate(void *const pointer, const unsigned long size) noexcept -> void {
+    --this->allocatedCount;
+
+    const unsigned long sizeClass{getSizeClass(size)};
+    if (sizeClass >= this->freeLists.size()) {
+        ::operator delete(pointer);
+
+        return;
+    }
+
+    const auto block{static_cast<Block *>(pointer)};
+    block->next = this->freeLists[sizeClass];
+    this->freeLists[sizeClass] = block;
+}
+
+auto FramePool::publish() const noexcept -> void {
+    Statistics &statistics{Statistics::get()};
+    statistics.set(Statistics::Counter::framePoolHit, this->hitCount);
+    statistics.set(Statistics::Counter::framePoolMiss, this->missCount);
+    statistics.set(Statistics::Counter::framePoolHighWater, this->highWater);
+}
+
+constexpr auto FramePool::getSizeClass(const unsigned long size) noexcept -> unsigned long {
+    return (size + granularity - 1) / granularity - 1;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+
+class FramePool {
+    struct Block {
+        Block *next;
+    };
+
+public:
+    [[nodiscard]] static auto get() -> FramePool &;
+
+    constexpr FramePool() noexcept = default;
+
+    FramePool(const FramePool &) = delete;
+
+    FramePool(FramePool &&) noexcept = delete;
+
+    auto operator=(const FramePool &) -> FramePool & = delete;
+
+    auto operator=(FramePool &&) noexcept -> FramePool & = delete;
+
+    ~FramePool();
+
+    [[nodiscard]] auto allocate(unsigned long size) -> void *;
+
+    auto deallocate(void *pointer, unsigned long size) noexcept -> void;
+
+    auto publish() const noexcept -> void;
+
+private:
+    [[nodiscard]] static constexpr auto getSizeClass(unsigned long size) noexcept -> unsigned long;
+
+    static constexpr unsigned long granularity{64}, sizeClassCount{32};
+
+    std::array<Block *, sizeClassCount> freeLists{};
+    unsigned long allocatedCount{}, highWater{}, hitCount{}, missCount{};
+};
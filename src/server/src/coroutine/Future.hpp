@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../ring/Ring.hpp"
+#include "Task.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+
+template<typename T>
+class Future {
+    enum class Status : unsigned char { empty, waiting, ready };
+
+    struct State {
+        explicit State(const int ringFileDescriptor) noexcept : ringFileDescriptor{ringFileDescriptor} {}
+
+        std::optional<T> value;
+        std::atomic<Status> status{Status::empty};
+        Task::promise_type *promise{};
+        int ringFileDescriptor;
+    };
+
+public:
+    explicit Future(const int ringFileDescriptor) : state{std::make_shared<State>(ringFileDescriptor)} {}
+
+    auto set(T value, Ring &ring) const -> void {
+        this->state->value.emplace(std::move(value));
+
+        if (this->state->status.exchange(Status::ready, std::memory_order::acq_rel) == Status::waiting)
+            ring.message(this->state->ringFileDescriptor, this->state->promise->getIndex());
+    }
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool {
+        return this->state->status.load(std::memory_order::acquire) == Status::ready;
+    }
+
+    template<typename Promise>
+    [[nodiscard]] auto await_suspend(const std::coroutine_handle<Promise> handle) const noexcept -> bool {
+        this->state->promise = &handle.promise().getRoot();
+
+        Status status{Status::empty};
+        if (!this->state->status.compare_exchange_strong(status, Status::waiting, std::memory_order::acq_rel))
+            return false;
+
+        this->state->promise->setLeaf(handle);
+
+        return true;
+    }
+
+    [[nodiscard]] auto await_resume() const -> T { return std::move(*this->state->value); }
+
+private:
+    std::shared_ptr<State> state;
+};
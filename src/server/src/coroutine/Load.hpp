@@ -0,0 +1,7 @@
+#pragma once
+
+#include <atomic>
+
+struct Load {
+    std::atomic_ulong clientCount, byteRate, commandRate;
+};
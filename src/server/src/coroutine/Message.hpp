@@ -0,0 +1,22 @@
+#pragma once
+
+#include "../../../common/Answer.hpp"
+#include "../../../common/Reply.hpp"
+#include "../fileDescriptor/DatabaseManager.hpp"
+
+class Context;
+
+struct Message {
+    static constexpr unsigned long tag{1UL << 63};
+    static constexpr unsigned int attemptLimit{3};
+
+    Context *context;
+    Answer answer;
+    std::vector<DatabaseManager::Part> parts;
+    std::vector<Reply> replies;
+    Reply reply;
+    unsigned long clientId;
+    int fileDescriptor;
+    unsigned int source, attemptCount;
+    bool isReplied;
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "../database/Context.hpp"
+
+struct Migration {
+    static constexpr unsigned long tag{1UL << 62};
+
+    Context context;
+};
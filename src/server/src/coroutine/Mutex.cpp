@@ -0,0 +1,22 @@
+#include "Mutex.hpp"
+
+#include <utility>
+
+Mutex::Locker::Locker(Mutex &mutex) noexcept : mutex{mutex} {}
+
+auto Mutex::Locker::await_ready() const noexcept -> bool { return this->mutex.tryLock(); }
+
+auto Mutex::lock() noexcept -> Locker { return Locker{*this}; }
+
+auto Mutex::tryLock() noexcept -> bool { return !std::exchange(this->isLocked, true); }
+
+auto Mutex::unlock() -> void {
+    if (this->waiters.empty()) {
+        this->isLocked = false;
+
+        return;
+    }
+
+    this->waiters.front()->wake();
+    this->waiters.pop();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Task.hpp"
+
+#include <coroutine>
+#include <queue>
+
+class Mutex {
+public:
+    class Locker {
+    public:
+        explicit Locker(Mutex &mutex) noexcept;
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool;
+
+        template<typename Promise>
+        auto await_suspend(const std::coroutine_handle<Promise> handle) const -> void {
+            Task::promise_type &promise{handle.promise().getRoot()};
+            promise.setLeaf(handle);
+
+            this->mutex.waiters.emplace(&promise);
+        }
+
+        constexpr auto await_resume() const noexcept -> void {}
+
+    private:
+        Mutex &mutex;
+    };
+
+    Mutex() = default;
+
+    Mutex(const Mutex &) = delete;
+
+    Mutex(Mutex &&) noexcept = delete;
+
+    auto operator=(const Mutex &) -> Mutex & = delete;
+
+    auto operator=(Mutex &&) noexcept -> Mutex & = delete;
+
+    ~Mutex() = default;
+
+    [[nodiscard]] auto lock() noexcept -> Locker;
+
+    [[nodiscard]] auto tryLock() noexcept -> bool;
+
+    auto unlock() -> void;
+
+private:
+    std::queue<Task::promise_type *> waiters;
+    bool isLocked{};
+};
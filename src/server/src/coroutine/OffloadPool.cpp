@@ -0,0 +1,51 @@
+#include "OffloadPool.hpp"
+
+#include "../fileDescriptor/DatabaseManager.hpp"
+#include "../ring/Ring.hpp"
+#include "Message.hpp"
+
+OffloadPool::OffloadPool(const unsigned long threadCount, DatabaseManager &databaseManager) :
+    databaseManager{databaseManager} {
+    for (unsigned long i{}; i != threadCount; ++i)
+        this->threads.emplace_back([this](const std::stop_token stopToken) { this->work(stopToken); });
+}
+
+auto OffloadPool::isEnabled() const noexcept -> bool { return !this->threads.empty(); }
+
+auto OffloadPool::submit(Message *const message, const int ringFileDescriptor) -> void {
+    {
+        const std::lock_guard lockGuard{this->lock};
+
+        this->messages.emplace(message, ringFileDescriptor);
+    }
+
+    this->condition.notify_one();
+}
+
+auto OffloadPool::work(const std::stop_token stopToken) -> void {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CLAMP | IORING_SETUP_SINGLE_ISSUER;
+    Ring ring{8, params};
+
+    while (true) {
+        std::pair<Message *, int> pair;
+        {
+            std::unique_lock uniqueLock{this->lock};
+            if (!this->condition.wait(uniqueLock, stopToken, [this] { return !this->messages.empty(); })) return;
+
+            pair = this->messages.front();
+            this->messages.pop();
+        }
+
+        const auto [message, ringFileDescriptor]{pair};
+        message->reply = this->databaseManager.query(*message->context, std::move(message->answer));
+        message->isReplied = true;
+
+        const unsigned long data{reinterpret_cast<unsigned long>(message) | Message::tag};
+        for (int result{-1}; result < 0 && !stopToken.stop_requested();) {
+            ring.submit(Submission{ringFileDescriptor, 0, 0, data, Submission::Message{data}});
+            ring.wait(1);
+            ring.advance(ring.poll([&result](const Completion &completion) { result = completion.outcome.result; }));
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class DatabaseManager;
+struct Message;
+
+class OffloadPool {
+public:
+    OffloadPool(unsigned long threadCount, DatabaseManager &databaseManager);
+
+    OffloadPool(const OffloadPool &) = delete;
+
+    OffloadPool(OffloadPool &&) noexcept = delete;
+
+    auto operator=(const OffloadPool &) -> OffloadPool & = delete;
+
+    auto operator=(OffloadPool &&) noexcept -> OffloadPool & = delete;
+
+    ~OffloadPool() = default;
+
+    [[nodiscard]] auto isEnabled() const noexcept -> bool;
+
+    auto submit(Message *message, int ringFileDescriptor) -> void;
+
+private:
+    auto work(std::stop_token stopToken) -> void;
+
+    DatabaseManager &databaseManager;
+    std::mutex lock;
+    std::condition_variable_any condition;
+    std::queue<std::pair<Message *, int>> messages;
+    std::vector<std::jthread> threads;
+};
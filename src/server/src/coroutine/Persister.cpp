@@ -0,0 +1,96 @@
+#include "Persister.hpp"
+
+#include "../../../common/Exception.hpp"
+#include "../fileDescriptor/DatabaseManager.hpp"
+#include "../ring/Ring.hpp"
+#include "../statistics/Statistics.hpp"
+#include "FramePool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+Persister::Persister(DatabaseManager &databaseManager, const unsigned long rate, const unsigned long chunkSize) :
+    databaseManager{databaseManager}, rate{rate}, chunkSize{chunkSize}, tokens{rate},
+    thread{[this](const std::stop_token stopToken) { this->run(stopToken); }} {}
+
+auto Persister::run(const std::stop_token stopToken) -> void {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN |
+                   IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+    Ring ring{8, params};
+
+    const std::array fileDescriptors{DatabaseManager::create(), Timer::create()};
+    ring.registerSparseFileDescriptor(fileDescriptors.size());
+    ring.updateFileDescriptors(0, fileDescriptors);
+
+    const Task task{this->persist()};
+    task.resume(Outcome{});
+
+    while (!stopToken.stop_requested()) {
+        for (const Task::promise_type *const promise : std::exchange(Task::promise_type::getPendings(), {}))
+            ring.submit(promise->getSubmission());
+
+        ring.wait(1);
+        ring.advance(ring.poll([&task](const Completion &completion) {
+            if (completion.userData != Ring::ignoredUserData) task.resume(completion.outcome);
+        }));
+    }
+}
+
+auto Persister::persist(const std::source_location sourceLocation) -> Task {
+    while (true) {
+        if (const auto [result, flags]{co_await this->timer.timing()}; result != sizeof(unsigned long)) {
+            throw Exception{
+                Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                    sourceLocation}
+            };
+        }
+        this->tokens = this->rate;
+        FramePool::get().publish();
+
+        if (this->databaseManager.isWritable() && this->databaseManager.isCanTruncate()) {
+            if (const auto [result, flags]{co_await this->databaseManager.truncate()}; result != 0) {
+                throw Exception{
+                    Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                        sourceLocation}
+                };
+            }
+        }
+
+        co_await this->write();
+    }
+}
+
+auto Persister::write(const std::source_location sourceLocation) -> AsyncTask<> {
+    Statistics &statistics{Statistics::get()};
+    const unsigned long size{this->databaseManager.getWriteSize()};
+    while (this->offset != size) {
+        if (this->rate != 0 && this->tokens == 0) {
+            statistics.add(Statistics::Counter::persistenceThrottle);
+
+            co_return;
+        }
+
+        unsigned long chunkSize{std::min(this->chunkSize, size - this->offset)};
+        if (this->rate != 0) chunkSize = std::min(chunkSize, this->tokens);
+
+        const auto [result, flags]{co_await this->databaseManager.write(this->offset, chunkSize)};
+        if (result < 0) {
+            throw Exception{
+                Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                    sourceLocation}
+            };
+        }
+
+        this->offset += result;
+        if (this->rate != 0) this->tokens -= result;
+
+        statistics.add(Statistics::Counter::persistenceChunk);
+        statistics.add(Statistics::Counter::persistenceByte, result);
+    }
+
+    if (size != 0) {
+        this->databaseManager.wrote();
+        this->offset = 0;
+    }
+}
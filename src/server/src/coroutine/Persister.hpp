@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../fileDescriptor/Timer.hpp"
+#include "AsyncTask.hpp"
+
+#include <source_location>
+#include <thread>
+
+class DatabaseManager;
+
+class Persister {
+public:
+    Persister(DatabaseManager &databaseManager, unsigned long rate, unsigned long chunkSize);
+
+    Persister(const Persister &) = delete;
+
+    Persister(Persister &&) noexcept = delete;
+
+    auto operator=(const Persister &) -> Persister & = delete;
+
+    auto operator=(Persister &&) noexcept -> Persister & = delete;
+
+    ~Persister() = default;
+
+private:
+    auto run(std::stop_token stopToken) -> void;
+
+    [[nodiscard]] auto persist(std::source_location sourceLocation = std::source_location::current()) -> Task;
+
+    [[nodiscard]] auto write(std::source_location sourceLocation = std::source_location::current()) -> AsyncTask<>;
+
+    DatabaseManager &databaseManager;
+    Timer timer{1};
+    unsigned long rate, chunkSize, tokens, offset{};
+    std::jthread thread;
+};
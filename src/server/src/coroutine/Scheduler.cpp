@@ -2,12 +2,17 @@
 
 #include "../../../common/Exception.hpp"
 #include "../../../common/Reply.hpp"
-#include "../fileDescriptor/Client.hpp"
-#include "../fileDescriptor/DatabaseManager.hpp"
 #include "../ring/Completion.hpp"
 #include "../ring/Ring.hpp"
-
-#include <ranges>
+#include "../statistics/Statistics.hpp"
+#include "FramePool.hpp"
+#include "Load.hpp"
+#include "Message.hpp"
+#include "Migration.hpp"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
 #include <sys/resource.h>
 
 auto Scheduler::getFileDescriptorLimit(const std::source_location sourceLocation) -> unsigned long {
@@ -21,6 +26,27 @@ auto Scheduler::getFileDescriptorLimit(const std::source_location sourceLocation
     return limit.rlim_cur;
 }
 
+auto Scheduler::getSiblingCpu(const unsigned int cpuCode) -> unsigned int {
+    std::ifstream file{std::format("/sys/devices/system/cpu/cpu{}/topology/thread_siblings_list", cpuCode)};
+
+    std::string range;
+    while (std::getline(file, range, ',')) {
+        const unsigned long separator{range.find('-')};
+        const unsigned long first{std::stoul(range.substr(0, separator))},
+            last{separator != std::string::npos ? std::stoul(range.substr(separator + 1)) : first};
+
+        for (unsigned long cpu{first}; cpu <= last; ++cpu) {
+            if (cpu != cpuCode) return cpu;
+        }
+    }
+
+    return (cpuCode + 1) % std::thread::hardware_concurrency();
+}
+
+auto Scheduler::getOwner(const long shard) noexcept -> unsigned int {
+    return static_cast<unsigned int>(static_cast<unsigned long>(shard) % ringFileDescriptors.size());
+}
+
 auto Scheduler::registerSignal(const std::source_location sourceLocation) -> void {
     struct sigaction signalAction {};
 
@@ -39,82 +65,538 @@ auto Scheduler::registerSignal(const std::source_location sourceLocation) -> voi
     }
 }
 
-Scheduler::Scheduler(const int sharedFileDescriptor, const unsigned int cpuCode, const bool main) :
-    ring{[sharedFileDescriptor] {
+Scheduler::Scheduler(const int sharedFileDescriptor, const unsigned int cpuCode) :
+    ring{[sharedFileDescriptor, cpuCode] {
         io_uring_params params{};
-        params.flags = IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN |
-                       IORING_SETUP_TASKRUN_FLAG | IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+        params.flags =
+            IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_CQSIZE;
+        params.cq_entries = std::max(configuration.completionQueueEntries, configuration.submissionQueueEntries);
+
+        switch (configuration.polling) {
+            case Configuration::Polling::sqpoll:
+                params.flags |= IORING_SETUP_SQPOLL | IORING_SETUP_SQ_AFF;
+                params.sq_thread_cpu = getSiblingCpu(cpuCode);
+                params.sq_thread_idle = configuration.sqpollIdle;
+                break;
+            case Configuration::Polling::spin:
+                params.flags |= IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+                break;
+            case Configuration::Polling::none:
+                params.flags |=
+                    IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG | IORING_SETUP_DEFER_TASKRUN;
+                break;
+        }
 
-        if (sharedFileDescriptor != -1) {
+        if (sharedFileDescriptor != -1 &&
+            (configuration.polling != Configuration::Polling::sqpoll || configuration.isSqpollShared)) {
             params.wq_fd = sharedFileDescriptor;
             params.flags |= IORING_SETUP_ATTACH_WQ;
         }
 
-        auto ring{std::make_shared<Ring>(2048 / std::thread::hardware_concurrency(), params)};
+        auto ring{std::make_shared<Ring>(configuration.submissionQueueEntries, params)};
 
         return ring;
     }()},
-    main{main} {
+    index{cpuCode}, isBundle{(this->ring->getFeatures() & IORING_FEAT_RECVSEND_BUNDLE) != 0},
+    isBatching{configuration.batchSize > 1 && (this->ring->getFeatures() & IORING_FEAT_MIN_TIMEOUT) != 0} {
     const unsigned long fileDescriptorLimit{getFileDescriptorLimit()};
 
+    this->tasks.reserve(entries);
+
     this->ring->registerSelfFileDescriptor();
     this->ring->registerCpu(cpuCode);
     this->ring->registerSparseFileDescriptor(fileDescriptorLimit);
 
     std::vector fileDescriptors{Logger::create("log.log"), Server::create("127.0.0.1", 9090), Timer::create()};
-    if (this->main) fileDescriptors.emplace_back(DatabaseManager::create());
 
     this->ring->allocateFileDescriptorRange(fileDescriptors.size(), fileDescriptorLimit - fileDescriptors.size());
     this->ring->updateFileDescriptors(0, fileDescriptors);
 
-    for (unsigned int i{}; i != entries; ++i) this->ringBuffer.addBuffer(this->bufferGroup.getBuffer(i), i);
+    for (unsigned long i{}; i != this->ringBuffers.size(); ++i) {
+        for (unsigned short j{}; j != this->bufferGroups[i].getCount(); ++j)
+            this->ringBuffers[i].addBuffer(this->bufferGroups[i].getBuffer(j), j);
+    }
+
+    if (configuration.fixedBufferCount != 0) this->ring->registerBuffers(this->fixedBufferPool.getIovecs());
+
+    DatabaseManager::setClientHandler(
+        [this](const std::span<const std::string_view> arguments) { return this->client(arguments); });
+
+    ringFileDescriptors[this->index] = this->ring->getFileDescriptor();
+    ready.count_down();
 }
 
 Scheduler::~Scheduler() {
-    for (const auto &client : this->clients | std::views::values)
-        this->submit(std::make_shared<Task>(this->close(client.getFileDescriptor())));
-    this->submit(std::make_shared<Task>(this->close(this->timer.getFileDescriptor())));
-    this->submit(std::make_shared<Task>(this->close(this->server.getFileDescriptor())));
-    this->submit(std::make_shared<Task>(this->close(this->logger->getFileDescriptor())));
-    if (this->main) this->submit(std::make_shared<Task>(this->close(databaseManager.getFileDescriptor())));
-
-    this->ring->wait(this->main ? 4 : 3 + this->clients.size());
+    DatabaseManager::setClientHandler({});
+
+    unsigned int count{3};
+    for (const auto &client : this->clients) {
+        if (client) {
+            this->submit(this->close(client->getFileDescriptor()));
+            ++count;
+        }
+    }
+    this->submit(this->close(this->timer.getFileDescriptor()));
+    this->submit(this->close(this->server.getFileDescriptor()));
+    this->submit(this->close(this->logger->getFileDescriptor()));
+
+    this->ring->wait(count);
     this->frame();
 }
 
 auto Scheduler::getRingFileDescriptor() const noexcept -> int { return this->ring->getFileDescriptor(); }
 
 auto Scheduler::run() -> void {
-    this->submit(std::make_shared<Task>(this->accept()));
-    this->submit(std::make_shared<Task>(this->timing()));
+    if (configuration.shardCount != 1 || configuration.migrationThreshold != 0) ready.wait();
+
+    this->submit(this->accept());
+    this->submit(this->timing());
 
+    Statistics &statistics{Statistics::get()};
+    int completionCount{};
     while (switcher.test(std::memory_order::relaxed)) {
-        if (this->logger->isWritable()) this->submit(std::make_shared<Task>(this->writeLog()));
+        if (this->logger->isWritable()) this->submit(this->writeLog());
+
+        if (!this->deferredClients.empty()) this->ring->wait(0);
+        else if (this->isBatching && completionCount > 1) {
+            this->ring->wait(configuration.batchSize, std::chrono::microseconds{configuration.batchWait});
+            statistics.add(Statistics::Counter::batchedWait);
+        } else if (configuration.polling == Configuration::Polling::spin &&
+                   this->ring->spin(std::chrono::microseconds{configuration.spinTime})) {
+            statistics.add(Statistics::Counter::spinHit);
+        } else {
+            if (configuration.polling == Configuration::Polling::spin)
+                statistics.add(Statistics::Counter::spinMiss);
+
+            const auto start{std::chrono::steady_clock::now()};
+            this->ring->wait(1);
+            const auto duration{std::chrono::steady_clock::now() - start};
+            statistics.add(Statistics::Counter::idleTime,
+                           std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+        }
 
-        this->ring->wait(1);
-        this->frame();
+        completionCount = this->frame();
     }
 }
 
-auto Scheduler::frame() -> void {
+auto Scheduler::frame() -> int {
+    const auto start{std::chrono::steady_clock::now()};
+    ++this->frameCount;
+
     const int completionCount{this->ring->poll([this](const Completion &completion) {
-        if (completion.outcome.result != 0 || (completion.outcome.flags & IORING_CQE_F_NOTIF) == 0) {
-            this->currentUserData = completion.userData;
-            const std::shared_ptr task{this->tasks.at(this->currentUserData)};
-            task->resume(completion.outcome);
-        }
+        if (completion.userData == Ring::ignoredUserData) return;
+
+        if ((completion.userData & Message::tag) != 0) {
+            auto *const message{reinterpret_cast<Message *>(completion.userData & ~Message::tag)};
+            if (completion.outcome.result < 0) this->redeliver(message, completion.outcome.result);
+            else this->handle(message);
+        } else if ((completion.userData & Migration::tag) != 0)
+            this->adopt(reinterpret_cast<Migration *>(completion.userData & ~Migration::tag),
+                        completion.outcome.result);
+        else this->resume(static_cast<unsigned int>(completion.userData), completion.outcome);
     })};
 
-    this->ring->advance(this->ringBuffer.getHandle(), completionCount, this->ringBuffer.getAddedBufferCount());
+    this->drain();
+    this->dispatch();
+    this->resumeDeferred();
+    this->replenish();
+    this->ring->advance(completionCount);
+
+    this->flush();
+
+    const auto duration{static_cast<unsigned long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count())};
+
+    Statistics &statistics{Statistics::get()};
+    statistics.add(Statistics::Counter::frame);
+    statistics.add(Statistics::Counter::frameCompletion, completionCount);
+    statistics.raise(Statistics::Counter::frameCompletionPeak, completionCount);
+    statistics.add(Statistics::Counter::frameTime, duration);
+    statistics.raise(Statistics::Counter::frameTimePeak, duration);
+
+    this->isOverloaded = configuration.shedThreshold != 0 && duration > configuration.shedThreshold;
+
+    return completionCount;
+}
+
+auto Scheduler::resumeDeferred() -> void {
+    for (const int fileDescriptor : std::exchange(this->deferredClients, {})) {
+        std::optional<Client> &client{this->clients[fileDescriptor]};
+        if (!client || !client->getIsDeferred()) continue;
+
+        client->setIsDeferred(false);
+        if (client->getIsClosing()) continue;
+
+        this->process(*client);
+
+        if (client->isWritable()) this->writableClients.emplace_back(fileDescriptor);
+    }
+}
+
+auto Scheduler::replenish() -> void {
+    Statistics &statistics{Statistics::get()};
+    for (RingBuffer &ringBuffer : this->ringBuffers)
+        statistics.add(Statistics::Counter::receiveBufferReplenish, ringBuffer.advance());
+
+    for (const int fileDescriptor : this->starvedClients) {
+        Client &client{*this->clients[fileDescriptor]};
+        if (client.getIsClosing()) {
+            client.setIsReceiving(false);
+            this->disconnect(client);
+        } else {
+            statistics.add(Statistics::Counter::receiveRearm);
+            this->arm(client);
+        }
+    }
+
+    this->starvedClients.clear();
+}
+
+auto Scheduler::flush() -> void {
+    for (const int fileDescriptor : this->writableClients) {
+        if (std::optional<Client> &client{this->clients[fileDescriptor]};
+            client && client->isWritable() && !client->getIsClosing())
+            this->submit(this->send(*client));
+    }
+
+    this->writableClients.clear();
+}
+
+auto Scheduler::disconnect(Client &client) -> void {
+    if (!client.getIsClosing()) {
+        client.setIsClosing(true);
+
+        if (client.getIsReceiving() || client.getIsSending()) this->submit(this->cancel(client.cancel()));
+    }
+
+    if (!client.getIsReceiving() && !client.getIsSending() && !client.getIsForwarding() && !client.getIsMigrating())
+        this->submit(this->close(client.getFileDescriptor()));
+}
+
+auto Scheduler::connect(const int fileDescriptor) -> Client & {
+    if (static_cast<unsigned long>(fileDescriptor) >= this->clients.size()) this->clients.resize(fileDescriptor + 1);
+    Client &client{this->clients[fileDescriptor].emplace(fileDescriptor, ++this->clientCount)};
+    ++this->activeClientCount;
+
+    client.setActiveTime(this->timerWheel.getTime());
+    if (configuration.idleTimeout != 0) {
+        this->timerWheel.add(TimerWheel::Timeout{
+            this->timerWheel.getTime() + configuration.idleTimeout, client.getId(), fileDescriptor});
+    }
+
+    return client;
+}
+
+auto Scheduler::arm(Client &client) -> void {
+    client.setIsReceiving(true);
+    client.setReceiveUserData(this->submit(this->receive(client)));
+}
+
+auto Scheduler::expire() -> void {
+    this->timerWheel.advance([this](const TimerWheel::Timeout timeout) {
+        std::optional<Client> &client{this->clients[timeout.fileDescriptor]};
+        if (!client || client->getId() != timeout.clientId || client->getIsClosing()) return;
+
+        if (const unsigned long expiration{client->getActiveTime() + configuration.idleTimeout};
+            expiration > this->timerWheel.getTime())
+            this->timerWheel.add(TimerWheel::Timeout{expiration, timeout.clientId, timeout.fileDescriptor});
+        else {
+            this->logger->push(Log{Log::Level::info, "idle timeout"});
+            Statistics::get().add(Statistics::Counter::idleTimeout);
+
+            this->disconnect(*client);
+        }
+    });
+}
+
+auto Scheduler::rebalance() -> void {
+    const unsigned long byteRate{std::exchange(this->receivedByteCount, 0)},
+        commandRate{std::exchange(this->processedCommandCount, 0)};
+
+    Load &load{loads[this->index]};
+    load.clientCount.store(this->activeClientCount, std::memory_order::relaxed);
+    load.byteRate.store(byteRate, std::memory_order::relaxed);
+    load.commandRate.store(commandRate, std::memory_order::relaxed);
+
+    Statistics &statistics{Statistics::get()};
+    statistics.set(Statistics::Counter::activeClient, this->activeClientCount);
+    statistics.set(Statistics::Counter::receiveByteRate, byteRate);
+    statistics.set(Statistics::Counter::commandRate, commandRate);
+
+    if (configuration.migrationThreshold == 0) return;
+
+    unsigned int target{this->index};
+    unsigned long targetRate{commandRate};
+    for (unsigned int i{}; i != loads.size(); ++i) {
+        if (const unsigned long rate{loads[i].commandRate.load(std::memory_order::relaxed)}; rate < targetRate) {
+            target = i;
+            targetRate = rate;
+        }
+    }
+
+    const bool isImbalanced{!this->isMigrating && target != this->index &&
+                            commandRate >= configuration.migrationThreshold};
+    Client *candidate{};
+    unsigned long candidateRate{};
+    for (std::optional<Client> &client : this->clients) {
+        if (!client) continue;
+
+        const unsigned long rate{client->getCommandRate()};
+        client->resetCommandRate();
+
+        if (isImbalanced && rate > candidateRate && rate <= (commandRate - targetRate) / 2 &&
+            client->getIsReceiving() && !client->getIsSending() && !client->getIsForwarding() &&
+            !client->getIsPaused() && !client->getIsDeferred() && !client->getIsClosing() &&
+            client->getQuerySize() == 0 && client->getWriteSize() == 0) {
+            candidate = &*client;
+            candidateRate = rate;
+        }
+    }
+
+    if (candidate == nullptr) return;
+
+    this->isMigrating = true;
+    this->migrationTarget = target;
+    candidate->setIsMigrating(true);
+
+    this->submit(this->cancel(candidate->cancelReceive()));
+}
+
+auto Scheduler::adopt(Migration *const migration, const int fileDescriptor,
+                      const std::source_location sourceLocation) -> void {
+    if (fileDescriptor < 0) {
+        this->logger->push(Log{
+            Log::Level::warn, std::error_code{std::abs(fileDescriptor), std::generic_category()}
+             .message(),
+            sourceLocation
+        });
+    } else {
+        Statistics::get().add(Statistics::Counter::migrationIn);
+
+        Client &client{this->connect(fileDescriptor)};
+        client.getContext() = std::move(migration->context);
+
+        this->arm(client);
+    }
+
+    delete migration;
+}
+
+auto Scheduler::process(Client &client) -> void {
+    Parser &parser{client.getParser()};
+    while (!client.getIsForwarding()) {
+        if ((configuration.clientCommandBudget != 0 &&
+             client.getCommandCount(this->frameCount) >= configuration.clientCommandBudget) ||
+            (configuration.clientByteBudget != 0 &&
+             client.getByteCount(this->frameCount) >= configuration.clientByteBudget)) {
+            if (parser.getSize() != 0 && !client.getIsDeferred()) {
+                Statistics::get().add(Statistics::Counter::clientDeferral);
+                client.setIsDeferred(true);
+
+                this->deferredClients.emplace_back(client.getFileDescriptor());
+            }
+
+            break;
+        }
+
+        const unsigned long size{parser.getSize()};
+        std::optional answer{parser.parse()};
+        if (const std::string_view error{parser.takeError()}; !error.empty()) {
+            this->push(client, Reply{Reply::Type::error, std::string{error}});
+            if (!parser.getIsInvalid()) continue;
+
+            this->logger->push(Log{Log::Level::warn, "protocol error"});
+
+            break;
+        }
+        if (!answer) break;
+
+        client.charge(this->frameCount, size - parser.getSize());
+        ++this->processedCommandCount;
+
+        if (this->isOverloaded && !client.getContext().getIsTransaction()) {
+            Statistics::get().add(Statistics::Counter::shed);
+            this->push(client, Reply{Reply::Type::error, "BUSY server is overloaded, try again later"});
+
+            continue;
+        }
+
+        if (const long shard{databaseManager.route(client.getContext(), *answer)};
+            shard == DatabaseManager::manyShards) {
+            std::vector parts{databaseManager.scatter(client.getContext(), *answer)};
+            this->forward(client, std::move(*answer), std::move(parts));
+        } else if (shard != DatabaseManager::anyShard && getOwner(shard) != this->index) {
+            std::vector<DatabaseManager::Part> parts;
+            parts.emplace_back(shard, std::move(*answer));
+            this->forward(client, Answer{}, std::move(parts));
+        } else if (offloadPool.isEnabled() && DatabaseManager::isCostly(answer->getCommand()) &&
+                 databaseManager.getCost(client.getContext(), *answer) >= configuration.offloadThreshold)
+            this->offload(client, std::move(*answer));
+        else this->push(client, databaseManager.query(client.getContext(), std::move(*answer)));
+    }
+
+    parser.compact();
 }
 
-auto Scheduler::submit(std::shared_ptr<Task> &&task) -> void {
-    task->resume(Outcome{});
-    this->ring->submit(task->getSubmission());
-    this->tasks.emplace(task->getSubmission().userData, std::move(task));
+auto Scheduler::forward(Client &client, Answer &&answer, std::vector<DatabaseManager::Part> &&parts) -> void {
+    Statistics::get().add(Statistics::Counter::forward);
+    client.setIsForwarding(true);
+
+    this->relay(new Message{
+        &client.getContext(), std::move(answer), std::move(parts), {}, Reply{Reply::Type::nil, 0},
+          client.getId(), client.getFileDescriptor(), this->index, 0, false
+    });
 }
 
-auto Scheduler::eraseCurrentTask() -> void { this->tasks.erase(this->currentUserData); }
+auto Scheduler::offload(Client &client, Answer &&answer) -> void {
+    Statistics::get().add(Statistics::Counter::offload);
+    client.setIsForwarding(true);
+
+    auto *const message{new Message{
+        &client.getContext(), std::move(answer), {}, {}, Reply{Reply::Type::nil, 0},
+          client.getId(), client.getFileDescriptor(), this->index, 0, false
+    }};
+    offloadPool.submit(message, this->ring->getFileDescriptor());
+}
+
+auto Scheduler::relay(Message *const message) -> void {
+    while (message->replies.size() != message->parts.size()) {
+        DatabaseManager::Part &part{message->parts[message->replies.size()]};
+        if (part.shard != DatabaseManager::anyShard && getOwner(part.shard) != this->index) {
+            this->post(message, getOwner(part.shard));
+
+            return;
+        }
+
+        message->replies.emplace_back(databaseManager.query(*message->context, std::move(part.answer), part.shard));
+    }
+
+    message->reply =
+        databaseManager.gather(*message->context, message->answer, message->parts, std::move(message->replies));
+    message->isReplied = true;
+
+    this->post(message, message->source);
+}
+
+auto Scheduler::post(Message *const message, const unsigned int target) -> void {
+    const unsigned long data{reinterpret_cast<unsigned long>(message) | Message::tag};
+    this->ring->message(ringFileDescriptors[target], data, data);
+}
+
+auto Scheduler::handle(Message *const message) -> void {
+    if (!message->isReplied) {
+        this->relay(message);
+
+        return;
+    }
+
+    Client &client{*this->clients[message->fileDescriptor]};
+    client.setIsForwarding(false);
+    if (!client.getIsClosing()) {
+        this->push(client, message->reply);
+        this->process(client);
+
+        if (client.isWritable()) this->writableClients.emplace_back(client.getFileDescriptor());
+    } else this->disconnect(client);
+
+    delete message;
+}
+
+auto Scheduler::redeliver(Message *const message, const int result) -> void {
+    Statistics::get().add(Statistics::Counter::messageFailure);
+    this->logger->push(Log{Log::Level::warn, std::error_code{std::abs(result), std::generic_category()}.message()});
+
+    if (!message->isReplied) {
+        if (++message->attemptCount != Message::attemptLimit) {
+            this->post(message, getOwner(message->parts[message->replies.size()].shard));
+
+            return;
+        }
+
+        message->reply = Reply{Reply::Type::error, "TRYAGAIN shard owner is unreachable",
+                               message->context->getDatabaseIndex(), message->context->getIsTransaction()};
+        message->isReplied = true;
+    }
+
+    if (message->source == this->index) this->handle(message);
+    else this->post(message, message->source);
+}
+
+auto Scheduler::push(Client &client, const Reply &reply) -> void {
+    if (client.getFixedBufferIndex() == -1 && !client.getIsSending() && client.getWriteSize() == 0) {
+        if (const int fixedBufferIndex{this->fixedBufferPool.acquire()}; fixedBufferIndex != -1)
+            client.attach(this->fixedBufferPool.getBuffer(fixedBufferIndex), fixedBufferIndex);
+    }
+
+    client.push(reply);
+}
+
+auto Scheduler::client(const std::span<const std::string_view> arguments) const -> Reply {
+    if (arguments.size() != 1 || !Answer::isKeyword(arguments[0], "LIST"))
+        return {Reply::Type::error, std::format("ERR unknown subcommand '{}'", arguments[0])};
+
+    std::string text;
+    for (const auto &client : this->clients) {
+        if (client) {
+            text += std::format("id={} fd={} idle={} qbuf={} obl={} paused={}\n", client->getId(),
+                                client->getFileDescriptor(), this->timerWheel.getTime() - client->getActiveTime(),
+                                client->getQuerySize(), client->getWriteSize(), client->getIsPaused() ? 1 : 0);
+        }
+    }
+
+    return {Reply::Type::string, std::move(text)};
+}
+
+auto Scheduler::submit(Task &&task) -> unsigned int {
+    unsigned int index;
+    if (!this->freeTaskIndexes.empty()) {
+        index = this->freeTaskIndexes.back();
+        this->freeTaskIndexes.pop_back();
+
+        this->tasks[index] = std::move(task);
+    } else {
+        index = this->tasks.size();
+        this->tasks.emplace_back(std::move(task));
+    }
+
+    this->tasks[index].setIndex(index);
+    this->resume(index, Outcome{});
+
+    return index;
+}
+
+auto Scheduler::resume(const unsigned int index, const Outcome outcome) -> void {
+    this->step(index, outcome);
+    this->drain();
+    this->dispatch();
+}
+
+auto Scheduler::step(const unsigned int index, const Outcome outcome) -> void {
+    this->tasks[index].resume(outcome);
+
+    if (this->tasks[index].isDone()) {
+        this->tasks[index] = Task{nullptr};
+        this->freeTaskIndexes.emplace_back(index);
+    }
+}
+
+auto Scheduler::drain() -> void {
+    std::vector<Task::promise_type *> &readies{Task::promise_type::getReadies()};
+    while (!readies.empty()) {
+        for (const Task::promise_type *const promise : std::exchange(readies, {}))
+            this->step(promise->getIndex(), Outcome{});
+    }
+}
+
+auto Scheduler::dispatch() -> void {
+    std::vector<Task::promise_type *> &pendings{Task::promise_type::getPendings()};
+    for (const Task::promise_type *const promise : pendings) {
+        Submission submission{promise->getSubmission()};
+        submission.userData = promise->getIndex();
+        this->ring->submit(submission);
+    }
+    pendings.clear();
+}
 
 auto Scheduler::writeLog(const std::source_location sourceLocation) -> Task {
     if (const auto [result, flags]{co_await this->logger->write()}; result < 0) {
@@ -124,22 +606,14 @@ auto Scheduler::writeLog(const std::source_location sourceLocation) -> Task {
         };
     }
     this->logger->wrote();
-
-    this->eraseCurrentTask();
 }
 
 auto Scheduler::accept(const std::source_location sourceLocation) -> Task {
     while (true) {
         if (const auto [result, flags]{co_await this->server.accept()};
-            result >= 0 && (flags & IORING_CQE_F_MORE) != 0) {
-            this->clients.emplace(result, Client{result});
-
-            Client &client{this->clients.at(result)};
-
-            this->submit(std::make_shared<Task>(this->receive(client)));
-        } else {
-            this->eraseCurrentTask();
-
+            result >= 0 && (flags & IORING_CQE_F_MORE) != 0)
+            this->arm(this->connect(result));
+        else {
             throw Exception{
                 Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
                     sourceLocation}
@@ -149,96 +623,232 @@ auto Scheduler::accept(const std::source_location sourceLocation) -> Task {
 }
 
 auto Scheduler::timing(const std::source_location sourceLocation) -> Task {
-    if (const auto [result, flags]{co_await this->timer.timing()}; result == sizeof(unsigned long))
-        this->submit(std::make_shared<Task>(this->timing()));
-    else {
+    if (const auto [result, flags]{co_await this->timer.timing()}; result == sizeof(unsigned long)) {
+        this->submit(this->timing());
+        this->expire();
+        this->rebalance();
+
+        if (configuration.shardCount != 1) {
+            for (unsigned long shard{this->index}; shard < configuration.shardCount;
+                 shard += ringFileDescriptors.size())
+                databaseManager.snapshot(shard);
+        }
+        FramePool::get().publish();
+    } else {
         throw Exception{
             Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
                 sourceLocation}
         };
     }
-
-    if (this->main && databaseManager.isWritable())
-        this->submit(std::make_shared<Task>(databaseManager.isCanTruncate() ? this->truncate() : this->writeData()));
-
-    this->eraseCurrentTask();
 }
 
 auto Scheduler::receive(Client &client, const std::source_location sourceLocation) -> Task {
-    std::vector<std::byte> receiveBuffer;
+    Statistics &statistics{Statistics::get()};
+    const unsigned long sizeClass{client.getIsBulk() ? 1UL : 0UL};
+    BufferGroup &bufferGroup{this->bufferGroups[sizeClass]};
+    RingBuffer &ringBuffer{this->ringBuffers[sizeClass]};
 
     while (true) {
-        if (const auto [result, flags]{co_await client.receive(this->ringBuffer.getId())};
-            result > 0 && (flags & IORING_CQE_F_MORE) != 0) {
-            const auto index{static_cast<unsigned short>(flags >> IORING_CQE_BUFFER_SHIFT)};
-            const std::span buffer{this->bufferGroup.getBuffer(index)}, receivedData{buffer.first(result)};
-            this->ringBuffer.addBuffer(buffer, index);
+        const auto [result, flags]{co_await client.receive(ringBuffer.getId(), this->isBundle)};
+        if (result > 0) {
+            client.setActiveTime(this->timerWheel.getTime());
+            this->receivedByteCount += result;
+
+            auto index{static_cast<unsigned short>(flags >> IORING_CQE_BUFFER_SHIFT)};
+            unsigned int bufferCount{1};
+            for (auto remainder{static_cast<unsigned int>(result)};;) {
+                const std::span buffer{bufferGroup.getBuffer(index)};
+                const unsigned int size{
+                    std::min(remainder, static_cast<unsigned int>(buffer.size()) - ringBuffer.getConsumedSize(index))};
+                const std::span data{buffer.subspan(ringBuffer.consume(index, size), size)};
+                if (!client.getIsClosing()) {
+                    client.getParser().append(data);
+                    this->process(client);
+                }
+
+                remainder -= size;
+                if (remainder == 0 && (flags & IORING_CQE_F_BUF_MORE) != 0) break;
+
+                ringBuffer.addBuffer(buffer, index);
+                index = ringBuffer.next();
+                if (remainder == 0) break;
+
+                ++bufferCount;
+            }
+            client.setIsBulk(static_cast<unsigned long>(result) >= this->bufferGroups[0].getSize());
+
+            if (bufferCount > 1) {
+                statistics.add(Statistics::Counter::receiveBundle);
+                statistics.add(Statistics::Counter::receiveBundleBuffer, bufferCount);
+            }
+
+            const unsigned long querySize{client.getQuerySize()}, outputSize{client.getWriteSize()};
+            statistics.raise(Statistics::Counter::queryBufferPeak, querySize);
+            statistics.raise(Statistics::Counter::outputBufferPeak, outputSize);
+
+            if (querySize > configuration.queryHardLimit || outputSize > configuration.outputHardLimit) {
+                if (!client.getIsClosing()) {
+                    this->logger->push(Log{
+                        Log::Level::warn,
+                        querySize > configuration.queryHardLimit ? "query buffer limit exceeded" :
+                                                                   "output buffer limit exceeded",
+                        sourceLocation
+                    });
+                    statistics.add(Statistics::Counter::clientLimitDisconnect);
+
+                    this->disconnect(client);
+                }
+            } else if (!client.getIsClosing()) {
+                if (querySize > configuration.querySoftLimit) statistics.add(Statistics::Counter::querySoftLimitHit);
+
+                if (outputSize > configuration.outputSoftLimit && !client.getIsPaused()) {
+                    statistics.add(Statistics::Counter::clientPause);
+                    client.setIsPaused(true);
+
+                    this->submit(this->cancel(client.cancelReceive()));
+                }
+
+                if (client.isWritable()) this->writableClients.emplace_back(client.getFileDescriptor());
+            }
 
-            receiveBuffer.insert(receiveBuffer.cend(), receivedData.cbegin(), receivedData.cend());
+            if ((flags & IORING_CQE_F_MORE) != 0) continue;
+        }
 
-            if ((flags & IORING_CQE_F_SOCK_NONEMPTY) == 0) {
-                std::vector response{databaseManager.query(client.getContext(), Answer{receiveBuffer}).serialize()};
-                receiveBuffer.clear();
+        if (result == -ENOBUFS) statistics.add(Statistics::Counter::receiveBufferExhaustion);
+        if (!client.getIsClosing() && (result > 0 || result == -ENOBUFS || result == -ECANCELED)) {
+            if (client.getIsMigrating()) {
+                client.setIsReceiving(false);
+                this->submit(this->migrate(client));
 
-                this->submit(std::make_shared<Task>(this->send(client, std::move(response))));
+                co_return;
             }
-        } else {
+
+            if (client.getIsPaused()) {
+                if (client.getWriteSize() != 0) {
+                    client.setIsReceiving(false);
+
+                    co_return;
+                }
+
+                client.setIsPaused(false);
+
+                continue;
+            }
+
+            if (result != -ECANCELED) {
+                this->starvedClients.emplace_back(client.getFileDescriptor());
+
+                co_return;
+            }
+        }
+
+        if (!client.getIsClosing()) {
             this->logger->push(Log{
                 Log::Level::warn,
-                result == 0 ? "connection closed" :
-                              std::error_code{std::abs(result), std::generic_category()}
-                              .message(),
+                result == 0 ? "connection closed" : std::error_code{std::abs(result), std::generic_category()}
+                      .message(),
                 sourceLocation
             });
-
-            this->submit(std::make_shared<Task>(this->close(client.getFileDescriptor())));
-
-            break;
         }
+
+        break;
     }
 
-    this->eraseCurrentTask();
+    client.setIsReceiving(false);
+    this->disconnect(client);
 }
 
-auto Scheduler::send(const Client &client, std::vector<std::byte> &&data, const std::source_location sourceLocation)
-    -> Task {
-    const std::vector response{std::move(data)};
-    if (const auto [result, flags]{co_await client.send(response)}; result <= 0) {
+auto Scheduler::send(Client &client, const std::source_location sourceLocation) -> Task {
+    Statistics &statistics{Statistics::get()};
+    const bool isZeroCopy{client.getWriteSize() >= configuration.zeroCopyThreshold};
+    const int fixedBufferIndex{client.getFixedBufferIndex()};
+    if (isZeroCopy)
+        statistics.add(fixedBufferIndex != -1 ? Statistics::Counter::fixedBufferSend :
+                                                Statistics::Counter::fixedBufferMiss);
+
+    const __kernel_timespec *const timeout{configuration.sendTimeout != 0 ? &this->sendTimeout : nullptr};
+    const auto [result, flags]{co_await (isZeroCopy ? client.sendZeroCopy(timeout) : client.send(timeout))};
+    if ((flags & IORING_CQE_F_MORE) != 0) co_await std::suspend_always{};
+    client.sent(result > 0 ? result : 0);
+    if (fixedBufferIndex != -1) this->fixedBufferPool.release(fixedBufferIndex);
+
+    statistics.add(isZeroCopy ? Statistics::Counter::zeroCopySend : Statistics::Counter::send);
+    if (result > 0) {
+        statistics.add(isZeroCopy ? Statistics::Counter::zeroCopySendByte : Statistics::Counter::sendByte, result);
+        client.setActiveTime(this->timerWheel.getTime());
+    }
+
+    if (result <= 0) {
+        const bool isTimeout{result == -ECANCELED && !client.getIsClosing()};
+        if (isTimeout) statistics.add(Statistics::Counter::sendTimeout);
+
         this->logger->push(Log{
             Log::Level::warn,
-            result == 0 ? "connection closed" : std::error_code{std::abs(result), std::generic_category()}
-                  .message(),
+            isTimeout   ? "send timeout" :
+            result == 0 ? "connection closed" :
+                          std::error_code{std::abs(result), std::generic_category()}.message(),
             sourceLocation
         });
 
-        this->submit(std::make_shared<Task>(this->close(client.getFileDescriptor())));
-    }
+        this->disconnect(client);
+    } else if (client.getIsClosing() || (client.getParser().getIsInvalid() && client.getWriteSize() == 0))
+        this->disconnect(client);
+    else {
+        if (client.getIsPaused() && !client.getIsReceiving() && client.getWriteSize() == 0) {
+            client.setIsPaused(false);
+            this->arm(client);
+        }
 
-    this->eraseCurrentTask();
+        if (client.isWritable()) this->writableClients.emplace_back(client.getFileDescriptor());
+    }
 }
 
-auto Scheduler::truncate(std::source_location sourceLocation) -> Task {
-    if (const auto [result, flags]{co_await databaseManager.truncate()}; result != 0) {
-        throw Exception{
-            Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
-                sourceLocation}
-        };
+auto Scheduler::migrate(Client &client, const std::source_location sourceLocation) -> Task {
+    Statistics &statistics{Statistics::get()};
+    if (!client.getIsClosing() && !client.getIsSending() && client.getQuerySize() == 0 &&
+        client.getWriteSize() == 0) {
+        auto *const migration{new Migration{std::move(client.getContext())}};
+
+        if (const auto [result, flags]{co_await client.migrate(ringFileDescriptors[this->migrationTarget],
+                                                                reinterpret_cast<unsigned long>(migration) |
+                                                                    Migration::tag)};
+            result >= 0) {
+            statistics.add(Statistics::Counter::migrationOut);
+            client.setIsMigrating(false);
+            client.setIsClosing(true);
+            this->isMigrating = false;
+
+            this->submit(this->close(client.getFileDescriptor()));
+
+            co_return;
+        } else {
+            this->logger->push(Log{
+                Log::Level::warn, std::error_code{std::abs(result), std::generic_category()}
+                 .message(),
+                sourceLocation
+            });
+
+            client.getContext() = std::move(migration->context);
+            delete migration;
+        }
     }
-    this->submit(std::make_shared<Task>(this->writeData()));
 
-    this->eraseCurrentTask();
+    statistics.add(Statistics::Counter::migrationAbort);
+    client.setIsMigrating(false);
+    this->isMigrating = false;
+
+    if (client.getIsClosing()) this->disconnect(client);
+    else this->arm(client);
 }
 
-auto Scheduler::writeData(std::source_location sourceLocation) -> Task {
-    if (const auto [result, flags]{co_await databaseManager.write()}; result < 0) {
-        throw Exception{
-            Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
-                sourceLocation}
-        };
+auto Scheduler::cancel(Awaiter awaiter, const std::source_location sourceLocation) -> Task {
+    if (const auto [result, flags]{co_await awaiter}; result < 0 && result != -ENOENT && result != -EALREADY) {
+        this->logger->push(Log{
+            Log::Level::warn, std::error_code{std::abs(result), std::generic_category()}
+             .message(),
+            sourceLocation
+        });
     }
-    databaseManager.wrote();
-
-    this->eraseCurrentTask();
 }
 
 auto Scheduler::close(const int fileDescriptor, const std::source_location sourceLocation) -> Task {
@@ -246,11 +856,12 @@ auto Scheduler::close(const int fileDescriptor, const std::source_location sourc
     if (fileDescriptor == this->logger->getFileDescriptor()) outcome = co_await this->logger->close();
     else if (fileDescriptor == this->server.getFileDescriptor()) outcome = co_await this->server.close();
     else if (fileDescriptor == this->timer.getFileDescriptor()) outcome = co_await this->timer.close();
-    else if (this->main && fileDescriptor == databaseManager.getFileDescriptor())
-        outcome = co_await databaseManager.close();
     else [[likely]] {
-        outcome = co_await this->clients.at(fileDescriptor).close();
-        this->clients.erase(fileDescriptor);
+        outcome = co_await this->clients[fileDescriptor]->close();
+        if (const int fixedBufferIndex{this->clients[fileDescriptor]->detach()}; fixedBufferIndex != -1)
+            this->fixedBufferPool.release(fixedBufferIndex);
+        this->clients[fileDescriptor].reset();
+        --this->activeClientCount;
     }
 
     if (outcome.result < 0) {
@@ -260,11 +871,17 @@ auto Scheduler::close(const int fileDescriptor, const std::source_location sourc
             sourceLocation
         });
     }
-
-    this->eraseCurrentTask();
 }
 
+const Configuration Scheduler::configuration{Configuration::load("tinyRedis.conf")};
 constinit std::atomic_flag Scheduler::switcher{true};
 const unsigned int Scheduler::entries{
     std::bit_ceil(static_cast<unsigned int>(getFileDescriptorLimit()) / std::thread::hardware_concurrency()) * 2};
-DatabaseManager Scheduler::databaseManager{3};
+std::vector<int> Scheduler::ringFileDescriptors(std::thread::hardware_concurrency());
+std::vector<Load> Scheduler::loads(std::thread::hardware_concurrency());
+std::latch Scheduler::ready{std::thread::hardware_concurrency()};
+DatabaseManager Scheduler::databaseManager{0, configuration.shardCount, configuration.listPackMaxEntries,
+                                           configuration.listPackMaxValue};
+OffloadPool Scheduler::offloadPool{configuration.shardCount == 1 ? configuration.offloadThreadCount : 0,
+                                   databaseManager};
+Persister Scheduler::persister{databaseManager, configuration.persistenceRate, configuration.persistenceChunkSize};
@@ -1,24 +1,39 @@
 #pragma once
 
+#include "../config/Configuration.hpp"
+#include "../fileDescriptor/Client.hpp"
+#include "../fileDescriptor/DatabaseManager.hpp"
 #include "../fileDescriptor/Logger.hpp"
 #include "../fileDescriptor/Server.hpp"
 #include "../fileDescriptor/Timer.hpp"
 #include "../ring/BufferGroup.hpp"
+#include "../ring/FixedBufferPool.hpp"
 #include "../ring/RingBuffer.hpp"
+#include "../timer/TimerWheel.hpp"
+#include "OffloadPool.hpp"
+#include "Persister.hpp"
 
-#include <unordered_map>
+#include <array>
+#include <deque>
+#include <latch>
+#include <optional>
 
-class Client;
-class DatabaseManager;
+struct Load;
+struct Message;
+struct Migration;
 
 class Scheduler {
     [[nodiscard]] static auto
         getFileDescriptorLimit(std::source_location sourceLocation = std::source_location::current()) -> unsigned long;
 
+    [[nodiscard]] static auto getSiblingCpu(unsigned int cpuCode) -> unsigned int;
+
+    [[nodiscard]] static auto getOwner(long shard) noexcept -> unsigned int;
+
 public:
     static auto registerSignal(std::source_location sourceLocation = std::source_location::current()) -> void;
 
-    Scheduler(int sharedFileDescriptor, unsigned int cpuCode, bool main);
+    Scheduler(int sharedFileDescriptor, unsigned int cpuCode);
 
     Scheduler(const Scheduler &) = delete;
 
@@ -35,11 +50,54 @@ public:
     auto run() -> void;
 
 private:
-    auto frame() -> void;
+    auto frame() -> int;
+
+    auto resumeDeferred() -> void;
+
+    auto replenish() -> void;
+
+    auto flush() -> void;
+
+    auto disconnect(Client &client) -> void;
+
+    [[nodiscard]] auto connect(int fileDescriptor) -> Client &;
+
+    auto arm(Client &client) -> void;
+
+    auto expire() -> void;
+
+    auto rebalance() -> void;
+
+    auto adopt(Migration *migration, int fileDescriptor,
+               std::source_location sourceLocation = std::source_location::current()) -> void;
+
+    auto process(Client &client) -> void;
+
+    auto forward(Client &client, Answer &&answer, std::vector<DatabaseManager::Part> &&parts) -> void;
 
-    auto submit(std::shared_ptr<Task> &&task) -> void;
+    auto offload(Client &client, Answer &&answer) -> void;
 
-    auto eraseCurrentTask() -> void;
+    auto relay(Message *message) -> void;
+
+    auto post(Message *message, unsigned int target) -> void;
+
+    auto handle(Message *message) -> void;
+
+    auto redeliver(Message *message, int result) -> void;
+
+    auto push(Client &client, const Reply &reply) -> void;
+
+    [[nodiscard]] auto client(std::span<const std::string_view> arguments) const -> Reply;
+
+    auto submit(Task &&task) -> unsigned int;
+
+    auto resume(unsigned int index, Outcome outcome) -> void;
+
+    auto step(unsigned int index, Outcome outcome) -> void;
+
+    auto drain() -> void;
+
+    auto dispatch() -> void;
 
     [[nodiscard]] auto writeLog(std::source_location sourceLocation = std::source_location::current()) -> Task;
 
@@ -50,28 +108,48 @@ private:
     [[nodiscard]] auto receive(Client &client, std::source_location sourceLocation = std::source_location::current())
         -> Task;
 
-    [[nodiscard]] auto send(const Client &client, std::vector<std::byte> &&data,
-                            std::source_location sourceLocation = std::source_location::current()) -> Task;
+    [[nodiscard]] auto send(Client &client, std::source_location sourceLocation = std::source_location::current())
+        -> Task;
 
-    [[nodiscard]] auto truncate(std::source_location sourceLocation = std::source_location::current()) -> Task;
+    [[nodiscard]] auto migrate(Client &client, std::source_location sourceLocation = std::source_location::current())
+        -> Task;
 
-    [[nodiscard]] auto writeData(std::source_location sourceLocation = std::source_location::current()) -> Task;
+    [[nodiscard]] auto cancel(Awaiter awaiter, std::source_location sourceLocation = std::source_location::current())
+        -> Task;
 
     [[nodiscard]] auto close(int fileDescriptor, std::source_location sourceLocation = std::source_location::current())
         -> Task;
 
+    static const Configuration configuration;
     static constinit std::atomic_flag switcher;
+    static std::vector<int> ringFileDescriptors;
+    static std::vector<Load> loads;
+    static std::latch ready;
     static const unsigned int entries;
     static DatabaseManager databaseManager;
+    static OffloadPool offloadPool;
+    static Persister persister;
 
     const std::shared_ptr<Ring> ring;
     const std::shared_ptr<Logger> logger{std::make_shared<Logger>(0)};
     const Server server{1};
     Timer timer{2};
-    std::unordered_map<int, Client> clients;
-    RingBuffer ringBuffer{this->ring, entries, 0};
-    BufferGroup bufferGroup{entries};
-    std::unordered_map<unsigned long, std::shared_ptr<Task>> tasks;
-    unsigned long currentUserData{};
-    bool main;
+    std::deque<std::optional<Client>> clients;
+    std::vector<int> writableClients, starvedClients, deferredClients;
+    TimerWheel timerWheel;
+    const __kernel_timespec sendTimeout{static_cast<long long>(configuration.sendTimeout), 0};
+    unsigned long clientCount{}, frameCount{}, activeClientCount{}, receivedByteCount{}, processedCommandCount{};
+    std::array<BufferGroup, 2> bufferGroups{
+        BufferGroup{std::bit_ceil(configuration.smallReceiveBufferCount), configuration.smallReceiveBufferSize},
+        BufferGroup{std::bit_ceil(configuration.largeReceiveBufferCount), configuration.largeReceiveBufferSize}
+    };
+    std::array<RingBuffer, 2> ringBuffers{
+        RingBuffer{this->ring, this->bufferGroups[0].getCount(), 0},
+        RingBuffer{this->ring, this->bufferGroups[1].getCount(), 1}
+    };
+    FixedBufferPool fixedBufferPool{configuration.fixedBufferCount, configuration.fixedBufferSize};
+    std::vector<Task> tasks;
+    std::vector<unsigned int> freeTaskIndexes;
+    unsigned int index, migrationTarget{};
+    bool isBundle, isBatching, isOverloaded{}, isMigrating{};
 };
@@ -1,21 +1,75 @@
 #include "Task.hpp"
 
+#include "FramePool.hpp"
+
+#include <linux/io_uring.h>
 #include <utility>
 
+auto Task::promise_type::getPendings() -> std::vector<promise_type *> & {
+    thread_local std::vector<promise_type *> pendings;
+
+    return pendings;
+}
+
+auto Task::promise_type::getReadies() -> std::vector<promise_type *> & {
+    thread_local std::vector<promise_type *> readies;
+
+    return readies;
+}
+
+auto Task::promise_type::operator new(const std::size_t size) -> void * { return FramePool::get().allocate(size); }
+
+auto Task::promise_type::operator delete(void *const pointer, const std::size_t size) noexcept -> void {
+    FramePool::get().deallocate(pointer, size);
+}
+
 auto Task::promise_type::get_return_object() -> Task {
     return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
 }
 
 auto Task::promise_type::unhandled_exception() const -> void { throw; }
 
-auto Task::promise_type::setSubmission(const Submission &submission) noexcept -> void { this->submission = submission; }
+auto Task::promise_type::isMultishot(const Submission &submission) noexcept -> bool {
+    const auto type{static_cast<Submission::Type>(submission.parameter.index())};
+
+    return type == Submission::Type::accept || type == Submission::Type::receive;
+}
+
+auto Task::promise_type::getRoot() noexcept -> promise_type & { return *this; }
+
+auto Task::promise_type::setSubmission(const Submission &submission, const std::coroutine_handle<> leaf) -> void {
+    const bool isArmed{this->isArmed && submission.fileDescriptor == this->submission.fileDescriptor &&
+                       submission.parameter.index() == this->submission.parameter.index()};
+
+    this->submission = submission;
+    this->leaf = leaf;
+
+    if (!isArmed) {
+        this->isArmed = false;
+
+        getPendings().emplace_back(this);
+    }
+}
 
 auto Task::promise_type::getSubmission() const noexcept -> const Submission & { return this->submission; }
 
-auto Task::promise_type::setOutcome(const Outcome outcome) noexcept -> void { this->outcome = outcome; }
+auto Task::promise_type::setOutcome(const Outcome outcome) noexcept -> void {
+    this->outcome = outcome;
+    this->isArmed = isMultishot(this->submission) && (outcome.flags & IORING_CQE_F_MORE) != 0;
+}
 
 auto Task::promise_type::getOutcome() const noexcept -> Outcome { return this->outcome; }
 
+auto Task::promise_type::setLeaf(const std::coroutine_handle<> leaf) noexcept -> void { this->leaf = leaf; }
+
+auto Task::promise_type::getLeaf() const noexcept -> std::coroutine_handle<> { return this->leaf; }
+
+auto Task::promise_type::wake() -> void { getReadies().emplace_back(this); }
+
+auto Task::promise_type::setIndex(const unsigned int index) noexcept -> void { this->index = index; }
+
+auto Task::promise_type::getIndex() const noexcept -> unsigned int { return this->index; }
+
 Task::Task(const std::coroutine_handle<promise_type> handle) noexcept : handle{handle} {}
 
 Task::Task(Task &&other) noexcept : handle{std::exchange(other.handle, nullptr)} {}
@@ -32,13 +86,18 @@ auto Task::operator=(Task &&other) noexcept -> Task & {
 
 Task::~Task() { this->destroy(); }
 
-auto Task::getSubmission() const -> const Submission & { return this->handle.promise().getSubmission(); }
+auto Task::setIndex(const unsigned int index) const noexcept -> void { this->handle.promise().setIndex(index); }
 
 auto Task::resume(const Outcome outcome) const -> void {
-    this->handle.promise().setOutcome(outcome);
-    this->handle.resume();
+    promise_type &promise{this->handle.promise()};
+    promise.setOutcome(outcome);
+
+    if (const std::coroutine_handle leaf{promise.getLeaf()}; leaf) leaf.resume();
+    else this->handle.resume();
 }
 
+auto Task::isDone() const noexcept -> bool { return this->handle.done(); }
+
 auto Task::destroy() const -> void {
     if (this->handle) this->handle.destroy();
 }
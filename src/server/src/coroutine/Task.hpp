@@ -4,20 +4,33 @@
 #include "../ring/Submission.hpp"
 
 #include <coroutine>
+#include <vector>
 
 class Task {
 public:
     class promise_type {
     public:
+        [[nodiscard]] static auto getPendings() -> std::vector<promise_type *> &;
+
+        [[nodiscard]] static auto getReadies() -> std::vector<promise_type *> &;
+
+        [[nodiscard]] static auto operator new(std::size_t size) -> void *;
+
+        static auto operator delete(void *pointer, std::size_t size) noexcept -> void;
+
         [[nodiscard]] auto get_return_object() -> Task;
 
         [[nodiscard]] constexpr auto initial_suspend() const noexcept { return std::suspend_always{}; }
 
         [[nodiscard]] constexpr auto final_suspend() const noexcept { return std::suspend_always{}; }
 
+        constexpr auto return_void() const noexcept -> void {}
+
         auto unhandled_exception() const -> void;
 
-        auto setSubmission(const Submission &submission) noexcept -> void;
+        [[nodiscard]] auto getRoot() noexcept -> promise_type &;
+
+        auto setSubmission(const Submission &submission, std::coroutine_handle<> leaf) -> void;
 
         [[nodiscard]] auto getSubmission() const noexcept -> const Submission &;
 
@@ -25,9 +38,24 @@ public:
 
         [[nodiscard]] auto getOutcome() const noexcept -> Outcome;
 
+        auto setLeaf(std::coroutine_handle<> leaf) noexcept -> void;
+
+        [[nodiscard]] auto getLeaf() const noexcept -> std::coroutine_handle<>;
+
+        auto wake() -> void;
+
+        auto setIndex(unsigned int index) noexcept -> void;
+
+        [[nodiscard]] auto getIndex() const noexcept -> unsigned int;
+
     private:
+        [[nodiscard]] static auto isMultishot(const Submission &submission) noexcept -> bool;
+
         Submission submission;
-        Outcome outcome;
+        Outcome outcome{};
+        std::coroutine_handle<> leaf;
+        unsigned int index{};
+        bool isArmed{};
     };
 
     explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
@@ -42,10 +70,12 @@ public:
 
     ~Task();
 
-    [[nodiscard]] auto getSubmission() const -> const Submission &;
+    auto setIndex(unsigned int index) const noexcept -> void;
 
     auto resume(Outcome outcome) const -> void;
 
+    [[nodiscard]] auto isDone() const noexcept -> bool;
+
 private:
     auto destroy() const -> void;
 
@@ -0,0 +1,56 @@
+#include "Arena.hpp"
+
+#include <utility>
+
+Arena::Arena(Arena &&other) noexcept :
+    chunks{std::move(other.chunks)}, freeLists{std::exchange(other.freeLists, {})},
+    remainder{std::exchange(other.remainder, {})} {}
+
+auto Arena::operator=(Arena &&other) noexcept -> Arena & {
+    if (this == &other) return *this;
+
+    this->chunks = std::move(other.chunks);
+    this->freeLists = std::exchange(other.freeLists, {});
+    this->remainder = std::exchange(other.remainder, {});
+
+    return *this;
+}
+
+auto Arena::allocate(const unsigned long size) -> void * {
+    const unsigned long sizeClass{getSizeClass(size)};
+    if (sizeClass >= this->freeLists.size()) return ::operator new(size);
+
+    if (Block *const block{this->freeLists[sizeClass]}; block != nullptr) {
+        this->freeLists[sizeClass] = block->next;
+
+        return block;
+    }
+
+    const unsigned long roundedSize{(sizeClass + 1) * granularity};
+    if (this->remainder.size() < roundedSize) {
+        this->remainder = std::span{
+            this->chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(chunkSize)).get(), chunkSize};
+    }
+
+    void *const pointer{this->remainder.data()};
+    this->remainder = this->remainder.subspan(roundedSize);
+
+    return pointer;
+}
+
+auto Arena::deallocate(void *const pointer, const unsigned long size) noexcept -> void {
+    const unsigned long sizeClass{getSizeClass(size)};
+    if (sizeClass >= this->freeLists.size()) {
+        ::operator delete(pointer);
+
+        return;
+    }
+
+    const auto block{static_cast<Block *>(pointer)};
+    block->next = this->freeLists[sizeClass];
+    this->freeLists[sizeClass] = block;
+}
+
+constexpr auto Arena::getSizeClass(const unsigned long size) noexcept -> unsigned long {
+    return (size + granularity - 1) / granularity - 1;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+class Arena {
+    struct Block {
+        Block *next;
+    };
+
+public:
+    Arena() = default;
+
+    Arena(const Arena &) = delete;
+
+    Arena(Arena &&) noexcept;
+
+    auto operator=(const Arena &) -> Arena & = delete;
+
+    auto operator=(Arena &&) noexcept -> Arena &;
+
+    ~Arena() = default;
+
+    [[nodiscard]] auto allocate(unsigned long size) -> void *;
+
+    auto deallocate(void *pointer, unsigned long size) noexcept -> void;
+
+private:
+    [[nodiscard]] static constexpr auto getSizeClass(unsigned long size) noexcept -> unsigned long;
+
+    static constexpr unsigned long granularity{16}, sizeClassCount{64}, chunkSize{64 * 1024};
+
+    std::vector<std::unique_ptr<std::byte[]>> chunks;
+    std::array<Block *, sizeClassCount> freeLists{};
+    std::span<std::byte> remainder;
+};
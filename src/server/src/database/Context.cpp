@@ -10,8 +10,16 @@ auto Context::getIsTransaction() const noexcept -> bool { return this->isTransac
 
 auto Context::setIsTransaction(const bool isTransaction) noexcept -> void { this->isTransaction = isTransaction; }
 
+auto Context::getProtocolVersion() const noexcept -> unsigned char { return this->protocolVersion; }
+
+auto Context::setProtocolVersion(const unsigned char protocolVersion) noexcept -> void {
+    this->protocolVersion = protocolVersion;
+}
+
 auto Context::addAnswer(Answer &&answer) -> void { this->answers.emplace_back(std::move(answer)); }
 
 auto Context::getAnswers() noexcept -> std::span<Answer> { return this->answers; }
 
+auto Context::getAnswers() const noexcept -> std::span<const Answer> { return this->answers; }
+
 auto Context::clearAnswers() noexcept -> void { this->answers.clear(); }
@@ -14,14 +14,21 @@ public:
 
     auto setIsTransaction(bool isTransaction) noexcept -> void;
 
+    [[nodiscard]] auto getProtocolVersion() const noexcept -> unsigned char;
+
+    auto setProtocolVersion(unsigned char protocolVersion) noexcept -> void;
+
     auto addAnswer(Answer &&answer) -> void;
 
     [[nodiscard]] auto getAnswers() noexcept -> std::span<Answer>;
 
+    [[nodiscard]] auto getAnswers() const noexcept -> std::span<const Answer>;
+
     auto clearAnswers() noexcept -> void;
 
 private:
     unsigned long databaseIndex{};
     bool isTransaction{};
+    unsigned char protocolVersion{2};
     std::vector<Answer> answers;
 };
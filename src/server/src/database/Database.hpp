@@ -1,8 +1,6 @@
 #pragma once
 
-#include "SkipList.hpp"
-
-#include <shared_mutex>
+#include "HashIndex.hpp"
 
 class Reply;
 
@@ -12,97 +10,114 @@ public:
 
     Database(const Database &) = delete;
 
-    Database(Database &&) noexcept;
+    Database(Database &&) noexcept = default;
 
     auto operator=(const Database &) -> Database & = delete;
 
-    auto operator=(Database &&) noexcept -> Database &;
+    auto operator=(Database &&) noexcept -> Database & = default;
 
     ~Database() = default;
 
-    [[nodiscard]] auto serialize() -> std::vector<std::byte>;
+    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+
+    [[nodiscard]] auto getSize(std::string_view key) const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getKeyCount() const noexcept -> unsigned long;
 
     auto flushDb() -> Reply;
 
-    [[nodiscard]] auto del(std::string_view statement) -> Reply;
+    [[nodiscard]] auto randomKey(unsigned long random) const -> Reply;
+
+    [[nodiscard]] auto del(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto exists(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto exists(std::string_view statement) -> Reply;
+    [[nodiscard]] auto move(std::span<Database> databases, std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto move(std::span<Database> databases, std::string_view statement) -> Reply;
+    [[nodiscard]] auto rename(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto rename(std::string_view statement) -> Reply;
+    [[nodiscard]] auto renameNx(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto renameNx(std::string_view statement) -> Reply;
+    [[nodiscard]] auto type(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto type(std::string_view statement) -> Reply;
+    [[nodiscard]] auto object(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto set(std::string_view statement) -> Reply;
+    [[nodiscard]] auto set(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto get(std::string_view statement) -> Reply;
+    [[nodiscard]] auto get(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto getRange(std::string_view statement) -> Reply;
+    [[nodiscard]] auto getRange(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto getBit(std::string_view statement) -> Reply;
+    [[nodiscard]] auto getBit(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto mGet(std::string_view statement) -> Reply;
+    [[nodiscard]] auto mGet(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto setBit(std::string_view statement) -> Reply;
+    [[nodiscard]] auto setBit(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto setNx(std::string_view statement) -> Reply;
+    [[nodiscard]] auto setNx(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto setRange(std::string_view statement) -> Reply;
+    [[nodiscard]] auto setRange(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto strlen(std::string_view statement) -> Reply;
+    [[nodiscard]] auto strlen(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto mSet(std::string_view statement) -> Reply;
+    [[nodiscard]] auto mSet(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto mSetNx(std::string_view statement) -> Reply;
+    [[nodiscard]] auto mSetNx(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto incr(std::string_view statement) -> Reply;
+    [[nodiscard]] auto incr(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto incrBy(std::string_view statement) -> Reply;
+    [[nodiscard]] auto incrBy(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto decr(std::string_view statement) -> Reply;
+    [[nodiscard]] auto decr(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto decrBy(std::string_view statement) -> Reply;
+    [[nodiscard]] auto decrBy(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto append(std::string_view statement) -> Reply;
+    [[nodiscard]] auto append(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hDel(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hDel(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hExists(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hExists(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hGet(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hGet(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hGetAll(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hGetAll(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hIncrBy(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hIncrBy(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hKeys(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hKeys(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hLen(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hLen(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hSet(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hSet(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hVals(std::string_view statement) -> Reply;
+    [[nodiscard]] auto hVals(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lIndex(std::string_view statement) -> Reply;
+    [[nodiscard]] auto lIndex(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lLen(std::string_view statement) -> Reply;
+    [[nodiscard]] auto lLen(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lPop(std::string_view statement) -> Reply;
+    [[nodiscard]] auto lPop(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lPush(std::string_view statement) -> Reply;
+    [[nodiscard]] auto lPush(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lPushX(std::string_view statement) -> Reply;
+    [[nodiscard]] auto lPushX(std::span<const std::string_view> arguments) -> Reply;
 
 private:
+    [[nodiscard]] auto find(std::string_view key) const noexcept -> Entry *;
+
+    [[nodiscard]] auto extract(std::string_view key) -> IntrusivePointer<Entry>;
+
+    auto insert(const IntrusivePointer<Entry> &entry) -> void;
+
+    auto erase(std::string_view key) -> bool;
+
+    auto clear() noexcept -> void;
+
     [[nodiscard]] auto crement(std::string_view key, long digital, bool isPlus) -> Reply;
 
     static constexpr std::string ok{"OK"};
     static const std::string wrongType, wrongInteger;
 
     unsigned long index;
-    SkipList skipList;
-    std::shared_mutex lock;
+    HashIndex hashIndex;
 };
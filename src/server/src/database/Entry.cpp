@@ -1,5 +1,9 @@
 #include "Entry.hpp"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+
 template<>
 struct std::hash<Entry::SortedSetElement> {
     [[nodiscard]] constexpr auto operator()(const Entry::SortedSetElement &other) const noexcept {
@@ -14,111 +18,354 @@ auto Entry::SortedSetElement::operator<=>(const SortedSetElement &other) const n
     return std::strong_ordering::equal;
 }
 
-Entry::Entry(std::string &&key, std::string &&value) noexcept :
-    type{Type::string}, key{std::move(key)}, value{std::move(value)} {}
+auto Entry::create(const std::string_view key, const std::string_view value) -> IntrusivePointer<Entry> {
+    if (const std::optional integer{parseInteger(value)}; integer) return allocate(key, {}, Value{*integer});
+    if (value.size() <= embeddedLimit)
+        return allocate(key, value, Value{Embedded{static_cast<unsigned int>(value.size())}});
 
-Entry::Entry(std::string &&key, std::unordered_map<std::string, std::string> &&value) noexcept :
-    type{Type::hash}, key{std::move(key)}, value{std::move(value)} {}
+    return allocate(key, {}, Value{std::make_unique<std::string>(value)});
+}
 
-Entry::Entry(std::string &&key, std::deque<std::string> &&value) noexcept :
-    type{Type::list}, key{std::move(key)}, value{std::move(value)} {}
+auto Entry::create(const std::string_view key, std::unordered_map<std::string, std::string> &&value)
+    -> IntrusivePointer<Entry> {
+    if (value.size() <= listPackEntryLimit && std::ranges::all_of(value, [](const auto &element) noexcept {
+            return element.first.size() <= listPackValueLimit && element.second.size() <= listPackValueLimit;
+        })) {
+        Packed<Type::hash> packed;
+        for (const auto &[field, fieldValue] : value) {
+            packed.listPack.insert(packed.listPack.end(), field);
+            packed.listPack.insert(packed.listPack.end(), fieldValue);
+        }
+
+        return allocate(key, {}, Value{std::move(packed)});
+    }
 
-Entry::Entry(std::string &&key, std::unordered_set<std::string> &&value) noexcept :
-    type{Type::set}, key{std::move(key)}, value{std::move(value)} {}
+    return allocate(key, {}, Value{std::make_unique<std::unordered_map<std::string, std::string>>(std::move(value))});
+}
 
-Entry::Entry(std::string &&key, std::set<SortedSetElement> &&value) noexcept :
-    type{Type::sortedSet}, key{std::move(key)}, value{std::move(value)} {}
+auto Entry::create(const std::string_view key, std::deque<std::string> &&value) -> IntrusivePointer<Entry> {
+    if (value.size() <= listPackEntryLimit && std::ranges::all_of(value, [](const std::string &element) noexcept {
+            return element.size() <= listPackValueLimit;
+        })) {
+        Packed<Type::list> packed;
+        for (const std::string_view element : value) packed.listPack.insert(packed.listPack.end(), element);
 
-Entry::Entry(std::span<const std::byte> serialization) {
-    this->type = *reinterpret_cast<const decltype(this->type) *>(serialization.data());
-    serialization = serialization.subspan(sizeof(this->type));
+        return allocate(key, {}, Value{std::move(packed)});
+    }
+
+    return allocate(key, {}, Value{std::make_unique<std::deque<std::string>>(std::move(value))});
+}
+
+auto Entry::create(const std::string_view key, std::unordered_set<std::string> &&value) -> IntrusivePointer<Entry> {
+    if (value.size() <= listPackEntryLimit && std::ranges::all_of(value, [](const std::string &element) noexcept {
+            return element.size() <= listPackValueLimit;
+        })) {
+        Packed<Type::set> packed;
+        for (const std::string_view element : value) packed.listPack.insert(packed.listPack.end(), element);
+
+        return allocate(key, {}, Value{std::move(packed)});
+    }
+
+    return allocate(key, {}, Value{std::make_unique<std::unordered_set<std::string>>(std::move(value))});
+}
+
+auto Entry::create(const std::string_view key, std::set<SortedSetElement> &&value) -> IntrusivePointer<Entry> {
+    return allocate(key, {}, Value{std::make_unique<std::set<SortedSetElement>>(std::move(value))});
+}
+
+auto Entry::create(std::span<const std::byte> serialization) -> IntrusivePointer<Entry> {
+    const auto type{*reinterpret_cast<const Type *>(serialization.data())};
+    serialization = serialization.subspan(sizeof(type));
 
     const auto size{*reinterpret_cast<const unsigned long *>(serialization.data())};
     serialization = serialization.subspan(sizeof(size));
 
-    this->key = std::string{reinterpret_cast<const char *>(serialization.data()), size};
+    const std::string_view key{reinterpret_cast<const char *>(serialization.data()), size};
     serialization = serialization.subspan(size);
 
-    switch (this->type) {
-        case Type::string:
-            this->deserializeString(serialization);
-            break;
+    switch (type) {
         case Type::hash:
-            this->deserializeHash(serialization);
-            break;
+            return create(key, deserializeHash(serialization));
         case Type::list:
-            this->deserializeList(serialization);
-            break;
+            return create(key, deserializeList(serialization));
         case Type::set:
-            this->deserializeSet(serialization);
-            break;
+            return create(key, deserializeSet(serialization));
         case Type::sortedSet:
-            this->deserializeSortedSet(serialization);
-            break;
+            return create(key, deserializeSortedSet(serialization));
+        default:
+            return create(key, std::string_view{reinterpret_cast<const char *>(serialization.data()),
+                                                serialization.size()});
     }
 }
 
-auto Entry::getType() const noexcept -> Type { return this->type; }
+auto Entry::setListPackLimit(const unsigned long entryCount, const unsigned long valueSize) noexcept -> void {
+    listPackEntryLimit = entryCount;
+    listPackValueLimit = valueSize;
+}
+
+auto Entry::retain() noexcept -> void { this->referenceCount.fetch_add(1, std::memory_order_relaxed); }
 
-auto Entry::getKey() const noexcept -> std::string_view { return this->key; }
+auto Entry::release() noexcept -> void {
+    if (this->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        this->~Entry();
+        ::operator delete(static_cast<void *>(this));
+    }
+}
 
-auto Entry::setKey(std::string &&key) noexcept -> void { this->key = std::move(key); }
+auto Entry::getType() const noexcept -> Type {
+    return std::visit(
+        []<typename T>(const T &) noexcept {
+            if constexpr (requires { T::packedType; }) return T::packedType;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::unordered_map<std::string, std::string>>>)
+                return Type::hash;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::deque<std::string>>>) return Type::list;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::unordered_set<std::string>>>) return Type::set;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::set<SortedSetElement>>>) return Type::sortedSet;
+            else return Type::string;
+        },
+        this->value);
+}
 
-auto Entry::getString() -> std::string & { return std::get<std::string>(this->value); }
+auto Entry::getEncoding() const noexcept -> Encoding {
+    return std::visit(
+        []<typename T>(const T &) noexcept {
+            if constexpr (std::is_same_v<T, long>) return Encoding::integer;
+            else if constexpr (std::is_same_v<T, Embedded>) return Encoding::embedded;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::string>>) return Encoding::raw;
+            else if constexpr (requires { T::packedType; }) return Encoding::listPack;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::deque<std::string>>>) return Encoding::quickList;
+            else if constexpr (std::is_same_v<T, std::unique_ptr<std::set<SortedSetElement>>>)
+                return Encoding::skipList;
+            else return Encoding::hashTable;
+        },
+        this->value);
+}
 
-auto Entry::getHash() -> std::unordered_map<std::string, std::string> & {
-    return std::get<std::unordered_map<std::string, std::string>>(this->value);
+auto Entry::getSize() const noexcept -> unsigned long {
+    return std::visit(
+        []<typename T>(const T &value) noexcept -> unsigned long {
+            if constexpr (std::is_same_v<T, Packed<Type::hash>>) return value.listPack.getCount() / 2;
+            else if constexpr (requires { T::packedType; }) return value.listPack.getCount();
+            else if constexpr (std::is_same_v<T, long> || std::is_same_v<T, Embedded> ||
+                               std::is_same_v<T, std::unique_ptr<std::string>>)
+                return 1;
+            else return value->size();
+        },
+        this->value);
 }
 
-auto Entry::getList() -> std::deque<std::string> & { return std::get<std::deque<std::string>>(this->value); }
+auto Entry::getKey(std::span<const std::byte> serialization) noexcept -> std::string_view {
+    serialization = serialization.subspan(sizeof(Type));
 
-auto Entry::getSet() -> std::unordered_set<std::string> & {
-    return std::get<std::unordered_set<std::string>>(this->value);
+    const auto size{*reinterpret_cast<const unsigned long *>(serialization.data())};
+
+    return {reinterpret_cast<const char *>(serialization.data()) + sizeof(size), size};
+}
+
+auto Entry::getKey() const noexcept -> std::string_view { return {this->getData(), this->keySize}; }
+
+auto Entry::rename(const std::string_view key) -> IntrusivePointer<Entry> {
+    return allocate(key, this->getEmbedded(), std::move(this->value));
+}
+
+auto Entry::getString() const -> std::string {
+    if (const auto integer{std::get_if<long>(&this->value)}; integer != nullptr) return std::to_string(*integer);
+    if (std::holds_alternative<Embedded>(this->value)) return std::string{this->getEmbedded()};
+
+    return *std::get<std::unique_ptr<std::string>>(this->value);
+}
+
+auto Entry::getStringSize() const noexcept -> unsigned long {
+    if (const auto integer{std::get_if<long>(&this->value)}; integer != nullptr) {
+        std::array<char, 20> buffer;
+
+        return std::to_chars(buffer.begin(), buffer.end(), *integer).ptr - buffer.begin();
+    }
+    if (const auto embedded{std::get_if<Embedded>(&this->value)}; embedded != nullptr) return embedded->size;
+
+    return std::get<std::unique_ptr<std::string>>(this->value)->size();
+}
+
+auto Entry::getRawString() -> std::string & {
+    if (!std::holds_alternative<std::unique_ptr<std::string>>(this->value))
+        this->value = std::make_unique<std::string>(this->getString());
+
+    return *std::get<std::unique_ptr<std::string>>(this->value);
+}
+
+auto Entry::getInteger() const noexcept -> std::optional<long> {
+    if (const auto integer{std::get_if<long>(&this->value)}; integer != nullptr) return *integer;
+    if (std::holds_alternative<Embedded>(this->value)) return parseInteger(this->getEmbedded());
+
+    return parseInteger(*std::get<std::unique_ptr<std::string>>(this->value));
+}
+
+auto Entry::setInteger(const long value) noexcept -> void { this->value = value; }
+
+auto Entry::getField(const std::string_view field) const -> std::optional<std::string_view> {
+    if (const auto packed{std::get_if<Packed<Type::hash>>(&this->value)}; packed != nullptr) {
+        if (ListPack::Iterator iterator{packed->listPack.find(field, 2)}; iterator != packed->listPack.end())
+            return *++iterator;
+
+        return std::nullopt;
+    }
+
+    const auto &hash{*std::get<std::unique_ptr<std::unordered_map<std::string, std::string>>>(this->value)};
+    if (const auto result{hash.find(std::string{field})}; result != hash.cend()) return result->second;
+
+    return std::nullopt;
+}
+
+auto Entry::setField(const std::string_view field, const std::string_view value) -> bool {
+    if (const auto packed{std::get_if<Packed<Type::hash>>(&this->value)};
+        packed != nullptr && field.size() <= listPackValueLimit && value.size() <= listPackValueLimit) {
+        ListPack &listPack{packed->listPack};
+
+        if (ListPack::Iterator iterator{listPack.find(field, 2)}; iterator != listPack.end()) {
+            listPack.replace(++iterator, value);
+
+            return false;
+        }
+
+        if (listPack.getCount() / 2 < listPackEntryLimit) {
+            listPack.insert(listPack.end(), field);
+            listPack.insert(listPack.end(), value);
+
+            return true;
+        }
+    }
+
+    return this->getHash().insert_or_assign(std::string{field}, std::string{value}).second;
+}
+
+auto Entry::eraseField(const std::string_view field) -> bool {
+    if (const auto packed{std::get_if<Packed<Type::hash>>(&this->value)}; packed != nullptr) {
+        if (const ListPack::Iterator iterator{packed->listPack.find(field, 2)}; iterator != packed->listPack.end()) {
+            packed->listPack.erase(iterator, 2);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    return this->getHash().erase(std::string{field}) != 0;
 }
 
-auto Entry::getSortedSet() -> std::set<SortedSetElement> & { return std::get<std::set<SortedSetElement>>(this->value); }
+auto Entry::getFields() const -> std::vector<std::pair<std::string_view, std::string_view>> {
+    std::vector<std::pair<std::string_view, std::string_view>> fields;
+
+    if (const auto packed{std::get_if<Packed<Type::hash>>(&this->value)}; packed != nullptr) {
+        fields.reserve(packed->listPack.getCount() / 2);
 
-auto Entry::setValue(std::string &&value) noexcept -> void {
-    this->type = Type::string;
-    this->value = std::move(value);
+        for (ListPack::Iterator iterator{packed->listPack.begin()}; iterator != packed->listPack.end(); ++iterator) {
+            const std::string_view field{*iterator};
+            fields.emplace_back(field, *++iterator);
+        }
+    } else {
+        for (const auto &[field, value] :
+             *std::get<std::unique_ptr<std::unordered_map<std::string, std::string>>>(this->value))
+            fields.emplace_back(field, value);
+    }
+
+    return fields;
 }
 
-auto Entry::setValue(std::unordered_map<std::string, std::string> &&value) noexcept -> void {
-    this->type = Type::hash;
-    this->value = std::move(value);
+auto Entry::getElement(const unsigned long index) const -> std::string_view {
+    if (const auto packed{std::get_if<Packed<Type::list>>(&this->value)}; packed != nullptr) {
+        ListPack::Iterator iterator{packed->listPack.begin()};
+        for (unsigned long i{}; i != index; ++i) ++iterator;
+
+        return *iterator;
+    }
+
+    return (*std::get<std::unique_ptr<std::deque<std::string>>>(this->value))[index];
 }
 
-auto Entry::setValue(std::deque<std::string> &&value) noexcept -> void {
-    this->type = Type::list;
-    this->value = std::move(value);
+auto Entry::pushFront(const std::string_view element) -> void {
+    if (const auto packed{std::get_if<Packed<Type::list>>(&this->value)};
+        packed != nullptr && element.size() <= listPackValueLimit && packed->listPack.getCount() < listPackEntryLimit) {
+        packed->listPack.insert(packed->listPack.begin(), element);
+
+        return;
+    }
+
+    this->getList().emplace_front(element);
 }
 
-auto Entry::setValue(std::unordered_set<std::string> &&value) noexcept -> void {
-    this->type = Type::set;
-    this->value = std::move(value);
+auto Entry::popFront() -> std::optional<std::string> {
+    if (this->getSize() == 0) return std::nullopt;
+
+    if (const auto packed{std::get_if<Packed<Type::list>>(&this->value)}; packed != nullptr) {
+        std::string element{*packed->listPack.begin()};
+        packed->listPack.erase(packed->listPack.begin());
+
+        return element;
+    }
+
+    std::deque<std::string> &list{this->getList()};
+    std::string element{std::move(list.front())};
+    list.pop_front();
+
+    return element;
+}
+
+auto Entry::getHash() -> std::unordered_map<std::string, std::string> & {
+    if (const auto packed{std::get_if<Packed<Type::hash>>(&this->value)}; packed != nullptr) {
+        auto hash{std::make_unique<std::unordered_map<std::string, std::string>>()};
+        for (ListPack::Iterator iterator{packed->listPack.begin()}; iterator != packed->listPack.end(); ++iterator) {
+            std::string field{*iterator};
+            hash->emplace(std::move(field), *++iterator);
+        }
+
+        this->value = std::move(hash);
+    }
+
+    return *std::get<std::unique_ptr<std::unordered_map<std::string, std::string>>>(this->value);
+}
+
+auto Entry::getList() -> std::deque<std::string> & {
+    if (const auto packed{std::get_if<Packed<Type::list>>(&this->value)}; packed != nullptr) {
+        auto list{std::make_unique<std::deque<std::string>>()};
+        for (const std::string_view element : packed->listPack) list->emplace_back(element);
+
+        this->value = std::move(list);
+    }
+
+    return *std::get<std::unique_ptr<std::deque<std::string>>>(this->value);
 }
 
-auto Entry::setValue(std::set<SortedSetElement> &&value) noexcept -> void {
-    this->type = Type::sortedSet;
-    this->value = std::move(value);
+auto Entry::getSet() -> std::unordered_set<std::string> & {
+    if (const auto packed{std::get_if<Packed<Type::set>>(&this->value)}; packed != nullptr) {
+        auto set{std::make_unique<std::unordered_set<std::string>>()};
+        for (const std::string_view element : packed->listPack) set->emplace(element);
+
+        this->value = std::move(set);
+    }
+
+    return *std::get<std::unique_ptr<std::unordered_set<std::string>>>(this->value);
+}
+
+auto Entry::getSortedSet() -> std::set<SortedSetElement> & {
+    return *std::get<std::unique_ptr<std::set<SortedSetElement>>>(this->value);
 }
 
 auto Entry::serialize() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    const auto typeBytes{std::as_bytes(std::span{&this->type, 1})};
+    const Type type{this->getType()};
+    const auto typeBytes{std::as_bytes(std::span{&type, 1})};
     serialization.insert(serialization.cend(), typeBytes.cbegin(), typeBytes.cend());
 
-    const std::vector serializedKey{this->serializeKey()};
-
-    const unsigned long size{serializedKey.size()};
+    const unsigned long size{this->keySize};
     const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
     serialization.insert(serialization.cend(), sizeBytes.cbegin(), sizeBytes.cend());
 
-    serialization.insert(serialization.cend(), serializedKey.cbegin(), serializedKey.cend());
+    const auto keyBytes{std::as_bytes(std::span{this->getKey()})};
+    serialization.insert(serialization.cend(), keyBytes.cbegin(), keyBytes.cend());
 
     std::vector<std::byte> serializedValue;
-    switch (this->type) {
+    switch (type) {
         case Type::string:
             serializedValue = this->serializeString();
             break;
@@ -140,22 +387,72 @@ auto Entry::serialize() const -> std::vector<std::byte> {
     return serialization;
 }
 
-auto Entry::serializeKey() const -> std::vector<std::byte> {
-    const auto bytes{std::as_bytes(std::span{this->key})};
+auto Entry::allocate(const std::string_view key, const std::string_view embedded, Value &&value)
+    -> IntrusivePointer<Entry> {
+    void *const memory{::operator new(sizeof(Entry) + key.size() + embedded.size())};
+    auto *const entry{new (memory) Entry{static_cast<unsigned int>(key.size()), std::move(value)}};
 
-    return {bytes.cbegin(), bytes.cend()};
+    char *const data{reinterpret_cast<char *>(entry + 1)};
+    std::ranges::copy(key, data);
+    std::ranges::copy(embedded, data + key.size());
+
+    return IntrusivePointer{entry};
+}
+
+auto Entry::parseInteger(const std::string_view value) noexcept -> std::optional<long> {
+    if (value.empty() || value.size() > 20 || (value.size() > 1 && value.front() == '0') ||
+        (value.size() > 1 && value.starts_with("-0")))
+        return std::nullopt;
+
+    long integer{};
+    if (const auto [pointer, error]{std::from_chars(value.data(), value.data() + value.size(), integer)};
+        error != std::errc{} || pointer != value.data() + value.size())
+        return std::nullopt;
+
+    return integer;
+}
+
+Entry::Entry(const unsigned int keySize, Value &&value) noexcept : value{std::move(value)}, keySize{keySize} {}
+
+auto Entry::getData() const noexcept -> const char * { return reinterpret_cast<const char *>(this + 1); }
+
+auto Entry::getEmbedded() const noexcept -> std::string_view {
+    if (const auto embedded{std::get_if<Embedded>(&this->value)}; embedded != nullptr)
+        return {this->getData() + this->keySize, embedded->size};
+
+    return {};
+}
+
+auto Entry::serializeListPack(const ListPack &listPack) -> std::vector<std::byte> {
+    std::vector<std::byte> serialization;
+
+    for (const std::string_view value : listPack) {
+        const unsigned long size{value.size()};
+        const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
+        serialization.insert(serialization.cend(), sizeBytes.cbegin(), sizeBytes.cend());
+
+        const auto valueBytes{std::as_bytes(std::span{value})};
+        serialization.insert(serialization.cend(), valueBytes.cbegin(), valueBytes.cend());
+    }
+
+    return serialization;
 }
 
 auto Entry::serializeString() const -> std::vector<std::byte> {
-    const auto bytes{std::as_bytes(std::span{std::get<std::string>(this->value)})};
+    const std::string value{this->getString()};
+    const auto bytes{std::as_bytes(std::span{value})};
 
     return {bytes.cbegin(), bytes.cend()};
 }
 
 auto Entry::serializeHash() const -> std::vector<std::byte> {
+    if (const auto packed{std::get_if<Packed<Type::hash>>(&this->value)}; packed != nullptr)
+        return serializeListPack(packed->listPack);
+
     std::vector<std::byte> serialization;
 
-    for (const auto &[key, value] : std::get<std::unordered_map<std::string, std::string>>(this->value)) {
+    for (const auto &[key, value] :
+         *std::get<std::unique_ptr<std::unordered_map<std::string, std::string>>>(this->value)) {
         const unsigned long keySize{key.size()};
         const auto keySizeBytes{std::as_bytes(std::span{&keySize, 1})};
         serialization.insert(serialization.cend(), keySizeBytes.cbegin(), keySizeBytes.cend());
@@ -175,9 +472,12 @@ auto Entry::serializeHash() const -> std::vector<std::byte> {
 }
 
 auto Entry::serializeList() const -> std::vector<std::byte> {
+    if (const auto packed{std::get_if<Packed<Type::list>>(&this->value)}; packed != nullptr)
+        return serializeListPack(packed->listPack);
+
     std::vector<std::byte> serialization;
 
-    for (const std::string_view value : std::get<std::deque<std::string>>(this->value)) {
+    for (const std::string_view value : *std::get<std::unique_ptr<std::deque<std::string>>>(this->value)) {
         const unsigned long size{value.size()};
         const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
         serialization.insert(serialization.cend(), sizeBytes.cbegin(), sizeBytes.cend());
@@ -190,9 +490,12 @@ auto Entry::serializeList() const -> std::vector<std::byte> {
 }
 
 auto Entry::serializeSet() const -> std::vector<std::byte> {
+    if (const auto packed{std::get_if<Packed<Type::set>>(&this->value)}; packed != nullptr)
+        return serializeListPack(packed->listPack);
+
     std::vector<std::byte> serialization;
 
-    for (const std::string_view value : std::get<std::unordered_set<std::string>>(this->value)) {
+    for (const std::string_view value : *std::get<std::unique_ptr<std::unordered_set<std::string>>>(this->value)) {
         const unsigned long size{value.size()};
         const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
         serialization.insert(serialization.cend(), sizeBytes.cbegin(), sizeBytes.cend());
@@ -207,7 +510,7 @@ auto Entry::serializeSet() const -> std::vector<std::byte> {
 auto Entry::serializeSortedSet() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    for (const auto &[value, score] : std::get<std::set<SortedSetElement>>(this->value)) {
+    for (const auto &[value, score] : *std::get<std::unique_ptr<std::set<SortedSetElement>>>(this->value)) {
         const unsigned long size{value.size()};
         const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
         serialization.insert(serialization.cend(), sizeBytes.cbegin(), sizeBytes.cend());
@@ -222,11 +525,8 @@ auto Entry::serializeSortedSet() const -> std::vector<std::byte> {
     return serialization;
 }
 
-auto Entry::deserializeString(const std::span<const std::byte> serialization) -> void {
-    this->value = std::string{reinterpret_cast<const char *>(serialization.data()), serialization.size()};
-}
-
-auto Entry::deserializeHash(std::span<const std::byte> serialization) -> void {
+auto Entry::deserializeHash(std::span<const std::byte> serialization)
+    -> std::unordered_map<std::string, std::string> {
     std::unordered_map<std::string, std::string> value;
 
     while (!serialization.empty()) {
@@ -243,10 +543,10 @@ auto Entry::deserializeHash(std::span<const std::byte> serialization) -> void {
         serialization = serialization.subspan(valueSize);
     }
 
-    this->value = std::move(value);
+    return value;
 }
 
-auto Entry::deserializeList(std::span<const std::byte> serialization) -> void {
+auto Entry::deserializeList(std::span<const std::byte> serialization) -> std::deque<std::string> {
     std::deque<std::string> value;
 
     while (!serialization.empty()) {
@@ -257,10 +557,10 @@ auto Entry::deserializeList(std::span<const std::byte> serialization) -> void {
         serialization = serialization.subspan(size);
     }
 
-    this->value = std::move(value);
+    return value;
 }
 
-auto Entry::deserializeSet(std::span<const std::byte> serialization) -> void {
+auto Entry::deserializeSet(std::span<const std::byte> serialization) -> std::unordered_set<std::string> {
     std::unordered_set<std::string> value;
 
     while (!serialization.empty()) {
@@ -271,10 +571,10 @@ auto Entry::deserializeSet(std::span<const std::byte> serialization) -> void {
         serialization = serialization.subspan(size);
     }
 
-    this->value = std::move(value);
+    return value;
 }
 
-auto Entry::deserializeSortedSet(std::span<const std::byte> serialization) -> void {
+auto Entry::deserializeSortedSet(std::span<const std::byte> serialization) -> std::set<SortedSetElement> {
     std::set<SortedSetElement> value;
 
     while (!serialization.empty()) {
@@ -290,5 +590,7 @@ auto Entry::deserializeSortedSet(std::span<const std::byte> serialization) -> vo
         value.emplace(std::move(key), score);
     }
 
-    this->value = std::move(value);
+    return value;
 }
+
+unsigned long Entry::listPackEntryLimit{128}, Entry::listPackValueLimit{64};
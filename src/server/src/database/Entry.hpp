@@ -1,6 +1,12 @@
 #pragma once
 
+#include "IntrusivePointer.hpp"
+#include "ListPack.hpp"
+
+#include <atomic>
 #include <deque>
+#include <memory>
+#include <optional>
 #include <set>
 #include <span>
 #include <string>
@@ -13,6 +19,8 @@ class Entry {
 public:
     enum class Type : unsigned char { string, hash, list, set, sortedSet };
 
+    enum class Encoding : unsigned char { integer, embedded, raw, listPack, hashTable, quickList, skipList };
+
     struct SortedSetElement {
         std::string key;
         double score;
@@ -20,25 +28,70 @@ public:
         [[nodiscard]] auto operator<=>(const SortedSetElement &) const noexcept -> std::strong_ordering;
     };
 
-    explicit Entry(std::string &&key, std::string &&value = {}) noexcept;
+    [[nodiscard]] static auto create(std::string_view key, std::string_view value) -> IntrusivePointer<Entry>;
+
+    [[nodiscard]] static auto create(std::string_view key, std::unordered_map<std::string, std::string> &&value)
+        -> IntrusivePointer<Entry>;
+
+    [[nodiscard]] static auto create(std::string_view key, std::deque<std::string> &&value) -> IntrusivePointer<Entry>;
+
+    [[nodiscard]] static auto create(std::string_view key, std::unordered_set<std::string> &&value)
+        -> IntrusivePointer<Entry>;
 
-    explicit Entry(std::string &&key, std::unordered_map<std::string, std::string> &&value = {}) noexcept;
+    [[nodiscard]] static auto create(std::string_view key, std::set<SortedSetElement> &&value)
+        -> IntrusivePointer<Entry>;
 
-    explicit Entry(std::string &&key, std::deque<std::string> &&value = {}) noexcept;
+    [[nodiscard]] static auto create(std::span<const std::byte> serialization) -> IntrusivePointer<Entry>;
 
-    explicit Entry(std::string &&key, std::unordered_set<std::string> &&value = {}) noexcept;
+    static auto setListPackLimit(unsigned long entryCount, unsigned long valueSize) noexcept -> void;
 
-    explicit Entry(std::string &&key, std::set<SortedSetElement> &&value = {}) noexcept;
+    Entry(const Entry &) = delete;
 
-    explicit Entry(std::span<const std::byte> serialization);
+    Entry(Entry &&) = delete;
+
+    auto operator=(const Entry &) -> Entry & = delete;
+
+    auto operator=(Entry &&) -> Entry & = delete;
+
+    auto retain() noexcept -> void;
+
+    auto release() noexcept -> void;
 
     [[nodiscard]] auto getType() const noexcept -> Type;
 
+    [[nodiscard]] auto getEncoding() const noexcept -> Encoding;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getKey(std::span<const std::byte> serialization) noexcept -> std::string_view;
+
     [[nodiscard]] auto getKey() const noexcept -> std::string_view;
 
-    auto setKey(std::string &&key) noexcept -> void;
+    [[nodiscard]] auto rename(std::string_view key) -> IntrusivePointer<Entry>;
+
+    [[nodiscard]] auto getString() const -> std::string;
+
+    [[nodiscard]] auto getStringSize() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getRawString() -> std::string &;
+
+    [[nodiscard]] auto getInteger() const noexcept -> std::optional<long>;
+
+    auto setInteger(long value) noexcept -> void;
+
+    [[nodiscard]] auto getField(std::string_view field) const -> std::optional<std::string_view>;
+
+    auto setField(std::string_view field, std::string_view value) -> bool;
 
-    [[nodiscard]] auto getString() -> std::string &;
+    auto eraseField(std::string_view field) -> bool;
+
+    [[nodiscard]] auto getFields() const -> std::vector<std::pair<std::string_view, std::string_view>>;
+
+    [[nodiscard]] auto getElement(unsigned long index) const -> std::string_view;
+
+    auto pushFront(std::string_view element) -> void;
+
+    [[nodiscard]] auto popFront() -> std::optional<std::string>;
 
     [[nodiscard]] auto getHash() -> std::unordered_map<std::string, std::string> &;
 
@@ -48,20 +101,44 @@ public:
 
     [[nodiscard]] auto getSortedSet() -> std::set<SortedSetElement> &;
 
-    auto setValue(std::string &&value) noexcept -> void;
+    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
 
-    auto setValue(std::unordered_map<std::string, std::string> &&value) noexcept -> void;
+private:
+    struct Embedded {
+        unsigned int size;
+    };
 
-    auto setValue(std::deque<std::string> &&value) noexcept -> void;
+    template<Type type>
+    struct Packed {
+        static constexpr Type packedType{type};
 
-    auto setValue(std::unordered_set<std::string> &&value) noexcept -> void;
+        ListPack listPack;
+    };
 
-    auto setValue(std::set<SortedSetElement> &&value) noexcept -> void;
+    using Value = std::variant<long, Embedded, std::unique_ptr<std::string>, Packed<Type::hash>,
+                               std::unique_ptr<std::unordered_map<std::string, std::string>>, Packed<Type::list>,
+                               std::unique_ptr<std::deque<std::string>>, Packed<Type::set>,
+                               std::unique_ptr<std::unordered_set<std::string>>,
+                               std::unique_ptr<std::set<SortedSetElement>>>;
 
-    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+    static constexpr unsigned long embeddedLimit{44};
 
-private:
-    [[nodiscard]] auto serializeKey() const -> std::vector<std::byte>;
+    static unsigned long listPackEntryLimit, listPackValueLimit;
+
+    [[nodiscard]] static auto allocate(std::string_view key, std::string_view embedded, Value &&value)
+        -> IntrusivePointer<Entry>;
+
+    [[nodiscard]] static auto parseInteger(std::string_view value) noexcept -> std::optional<long>;
+
+    Entry(unsigned int keySize, Value &&value) noexcept;
+
+    ~Entry() = default;
+
+    [[nodiscard]] auto getData() const noexcept -> const char *;
+
+    [[nodiscard]] auto getEmbedded() const noexcept -> std::string_view;
+
+    [[nodiscard]] static auto serializeListPack(const ListPack &listPack) -> std::vector<std::byte>;
 
     [[nodiscard]] auto serializeString() const -> std::vector<std::byte>;
 
@@ -73,19 +150,18 @@ private:
 
     [[nodiscard]] auto serializeSortedSet() const -> std::vector<std::byte>;
 
-    auto deserializeString(std::span<const std::byte> serialization) -> void;
-
-    auto deserializeHash(std::span<const std::byte> serialization) -> void;
+    [[nodiscard]] static auto deserializeHash(std::span<const std::byte> serialization)
+        -> std::unordered_map<std::string, std::string>;
 
-    auto deserializeList(std::span<const std::byte> serialization) -> void;
+    [[nodiscard]] static auto deserializeList(std::span<const std::byte> serialization) -> std::deque<std::string>;
 
-    auto deserializeSet(std::span<const std::byte> serialization) -> void;
+    [[nodiscard]] static auto deserializeSet(std::span<const std::byte> serialization)
+        -> std::unordered_set<std::string>;
 
-    auto deserializeSortedSet(std::span<const std::byte> serialization) -> void;
+    [[nodiscard]] static auto deserializeSortedSet(std::span<const std::byte> serialization)
+        -> std::set<SortedSetElement>;
 
-    Type type;
-    std::string key;
-    std::variant<std::string, std::unordered_map<std::string, std::string>, std::deque<std::string>,
-                 std::unordered_set<std::string>, std::set<SortedSetElement>>
-        value;
+    Value value;
+    std::atomic_uint referenceCount{1};
+    unsigned int keySize;
 };
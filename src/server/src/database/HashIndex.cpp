@@ -0,0 +1,204 @@
+#include "HashIndex.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+HashIndex::Table::Table(const unsigned long capacity) : controls(capacity, empty), slots(capacity) {}
+
+auto HashIndex::find(const std::string_view key) const noexcept -> Entry * {
+    const unsigned long hash{HashIndex::hash(key)};
+
+    if (const long slot{locate(this->current, key, hash)}; slot != -1) return this->current.slots[slot].get();
+    if (const long slot{locate(this->previous, key, hash)}; slot != -1) return this->previous.slots[slot].get();
+
+    return nullptr;
+}
+
+auto HashIndex::insert(const IntrusivePointer<Entry> &entry) -> void {
+    const std::string_view key{entry->getKey()};
+    const unsigned long hash{HashIndex::hash(key)};
+
+    this->rehash(rehashStep);
+
+    if (const long slot{locate(this->current, key, hash)}; slot != -1) {
+        this->current.slots[slot] = entry;
+
+        return;
+    }
+    if (const long slot{locate(this->previous, key, hash)}; slot != -1) remove(this->previous, slot);
+
+    if ((this->current.size + this->current.tombstoneCount + 1) * 8 > this->current.slots.size() * 7) this->grow();
+
+    place(this->current, IntrusivePointer{entry}, hash);
+}
+
+auto HashIndex::erase(const std::string_view key) -> bool { return this->extract(key) != nullptr; }
+
+auto HashIndex::extract(const std::string_view key) -> IntrusivePointer<Entry> {
+    const unsigned long hash{HashIndex::hash(key)};
+
+    this->rehash(rehashStep);
+
+    for (Table *const table : {&this->current, &this->previous}) {
+        if (const long slot{locate(*table, key, hash)}; slot != -1) {
+            IntrusivePointer entry{std::move(table->slots[slot])};
+            remove(*table, slot);
+
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+auto HashIndex::clear() noexcept -> void {
+    this->current = Table{};
+    this->previous = Table{};
+    this->rehashGroup = 0;
+}
+
+auto HashIndex::getSize() const noexcept -> unsigned long { return this->current.size + this->previous.size; }
+
+auto HashIndex::sample(unsigned long random) const noexcept -> Entry * {
+    if (this->getSize() == 0) return nullptr;
+
+    const unsigned long capacity{this->current.slots.size() + this->previous.slots.size()};
+    for (unsigned long i{}; i != sampleCount; ++i) {
+        random = mix(random);
+        if (Entry *const entry{this->getSlot(random % capacity)}; entry != nullptr) return entry;
+    }
+
+    for (unsigned long position{random % capacity};; position = (position + 1) % capacity) {
+        if (Entry *const entry{this->getSlot(position)}; entry != nullptr) return entry;
+    }
+}
+
+auto HashIndex::hash(const std::string_view key) noexcept -> unsigned long {
+    return std::hash<std::string_view>{}(key);
+}
+
+auto HashIndex::mix(unsigned long random) noexcept -> unsigned long {
+    random += 0x9E3779B97F4A7C15;
+    random = (random ^ random >> 30) * 0xBF58476D1CE4E5B9;
+    random = (random ^ random >> 27) * 0x94D049BB133111EB;
+
+    return random ^ random >> 31;
+}
+
+auto HashIndex::getSlot(const unsigned long position) const noexcept -> Entry * {
+    const unsigned long size{this->current.slots.size()};
+
+    return (position < size ? this->current.slots[position] : this->previous.slots[position - size]).get();
+}
+
+auto HashIndex::match(const signed char *const controls, const signed char control) noexcept -> unsigned int {
+#ifdef __SSE2__
+    const __m128i group{_mm_loadu_si128(reinterpret_cast<const __m128i *>(controls))};
+
+    return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(control))));
+#else
+    unsigned int mask{};
+    for (unsigned int i{}; i != groupWidth; ++i) {
+        if (controls[i] == control) mask |= 1U << i;
+    }
+
+    return mask;
+#endif
+}
+
+auto HashIndex::matchFree(const signed char *const controls) noexcept -> unsigned int {
+#ifdef __SSE2__
+    return static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(controls))));
+#else
+    unsigned int mask{};
+    for (unsigned int i{}; i != groupWidth; ++i) {
+        if (controls[i] < 0) mask |= 1U << i;
+    }
+
+    return mask;
+#endif
+}
+
+auto HashIndex::locate(const Table &table, const std::string_view key, const unsigned long hash) noexcept -> long {
+    if (table.size == 0) return -1;
+
+    const unsigned long groupMask{table.slots.size() / groupWidth - 1};
+    const auto control{static_cast<signed char>(hash & 0x7F)};
+    for (unsigned long group{(hash >> 7) & groupMask}, step{}; step <= groupMask;
+         group = (group + ++step) & groupMask) {
+        const signed char *const controls{table.controls.data() + group * groupWidth};
+
+        for (unsigned int mask{match(controls, control)}; mask != 0; mask &= mask - 1) {
+            if (const unsigned long slot{group * groupWidth + std::countr_zero(mask)};
+                table.slots[slot]->getKey() == key)
+                return static_cast<long>(slot);
+        }
+
+        if (match(controls, empty) != 0) break;
+    }
+
+    return -1;
+}
+
+auto HashIndex::place(Table &table, IntrusivePointer<Entry> &&entry, const unsigned long hash) -> void {
+    const unsigned long groupMask{table.slots.size() / groupWidth - 1};
+    for (unsigned long group{(hash >> 7) & groupMask}, step{};; group = (group + ++step) & groupMask) {
+        if (const unsigned int mask{matchFree(table.controls.data() + group * groupWidth)}; mask != 0) {
+            const unsigned long slot{group * groupWidth + std::countr_zero(mask)};
+            if (table.controls[slot] == deleted) --table.tombstoneCount;
+
+            table.controls[slot] = static_cast<signed char>(hash & 0x7F);
+            table.slots[slot] = std::move(entry);
+            ++table.size;
+
+            return;
+        }
+    }
+}
+
+auto HashIndex::remove(Table &table, const unsigned long slot) noexcept -> void {
+    if (match(table.controls.data() + slot / groupWidth * groupWidth, empty) != 0) table.controls[slot] = empty;
+    else {
+        table.controls[slot] = deleted;
+        ++table.tombstoneCount;
+    }
+
+    table.slots[slot].reset();
+    --table.size;
+}
+
+auto HashIndex::grow() -> void {
+    this->rehash(this->previous.slots.size() / groupWidth);
+
+    const unsigned long capacity{this->current.size * 2 >= this->current.slots.size() ?
+                                     this->current.slots.size() * 2 :
+                                     this->current.slots.size()};
+    this->previous = std::exchange(this->current, Table{std::max(capacity, groupWidth)});
+    this->rehashGroup = 0;
+}
+
+auto HashIndex::rehash(const unsigned long groupCount) -> void {
+    if (this->previous.slots.empty()) return;
+
+    const unsigned long end{std::min(this->rehashGroup + groupCount, this->previous.slots.size() / groupWidth)};
+    for (; this->rehashGroup != end && this->previous.size != 0; ++this->rehashGroup) {
+        for (unsigned long slot{this->rehashGroup * groupWidth}; slot != (this->rehashGroup + 1) * groupWidth; ++slot) {
+            if (this->previous.controls[slot] < 0) continue;
+
+            const unsigned long hash{HashIndex::hash(this->previous.slots[slot]->getKey())};
+            place(this->current, std::move(this->previous.slots[slot]), hash);
+            this->previous.controls[slot] = deleted;
+            --this->previous.size;
+        }
+    }
+
+    if (this->rehashGroup == this->previous.slots.size() / groupWidth || this->previous.size == 0) {
+        this->previous = Table{};
+        this->rehashGroup = 0;
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Entry.hpp"
+
+#include <string_view>
+#include <vector>
+
+class HashIndex {
+    struct Table {
+        explicit Table(unsigned long capacity = 0);
+
+        std::vector<signed char> controls;
+        std::vector<IntrusivePointer<Entry>> slots;
+        unsigned long size{}, tombstoneCount{};
+    };
+
+public:
+    HashIndex() = default;
+
+    HashIndex(const HashIndex &) = delete;
+
+    HashIndex(HashIndex &&) noexcept = default;
+
+    auto operator=(const HashIndex &) -> HashIndex & = delete;
+
+    auto operator=(HashIndex &&) noexcept -> HashIndex & = default;
+
+    ~HashIndex() = default;
+
+    [[nodiscard]] auto find(std::string_view key) const noexcept -> Entry *;
+
+    auto insert(const IntrusivePointer<Entry> &entry) -> void;
+
+    auto erase(std::string_view key) -> bool;
+
+    [[nodiscard]] auto extract(std::string_view key) -> IntrusivePointer<Entry>;
+
+    auto clear() noexcept -> void;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto sample(unsigned long random) const noexcept -> Entry *;
+
+    template<typename Action>
+    auto forEach(Action &&action) const -> void {
+        for (const Table *const table : {&this->previous, &this->current}) {
+            for (const IntrusivePointer<Entry> &entry : table->slots) {
+                if (entry != nullptr) action(*entry);
+            }
+        }
+    }
+
+private:
+    static constexpr unsigned long groupWidth{16}, rehashStep{2}, sampleCount{16};
+    static constexpr signed char empty{-128}, deleted{-2};
+
+    [[nodiscard]] static auto hash(std::string_view key) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto mix(unsigned long random) noexcept -> unsigned long;
+
+    [[nodiscard]] auto getSlot(unsigned long position) const noexcept -> Entry *;
+
+    [[nodiscard]] static auto match(const signed char *controls, signed char control) noexcept -> unsigned int;
+
+    [[nodiscard]] static auto matchFree(const signed char *controls) noexcept -> unsigned int;
+
+    [[nodiscard]] static auto locate(const Table &table, std::string_view key, unsigned long hash) noexcept -> long;
+
+    static auto place(Table &table, IntrusivePointer<Entry> &&entry, unsigned long hash) -> void;
+
+    static auto remove(Table &table, unsigned long slot) noexcept -> void;
+
+    auto grow() -> void;
+
+    auto rehash(unsigned long groupCount) -> void;
+
+    Table current, previous;
+    unsigned long rehashGroup{};
+};
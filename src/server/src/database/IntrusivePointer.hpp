@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+template<typename T>
+class IntrusivePointer {
+public:
+    constexpr IntrusivePointer() noexcept = default;
+
+    constexpr IntrusivePointer(std::nullptr_t) noexcept {}
+
+    explicit IntrusivePointer(T *const pointer) noexcept : pointer{pointer} {}
+
+    IntrusivePointer(const IntrusivePointer &other) noexcept : pointer{other.pointer} {
+        if (this->pointer != nullptr) this->pointer->retain();
+    }
+
+    IntrusivePointer(IntrusivePointer &&other) noexcept : pointer{std::exchange(other.pointer, nullptr)} {}
+
+    auto operator=(const IntrusivePointer &other) noexcept -> IntrusivePointer & {
+        if (this != &other) {
+            if (other.pointer != nullptr) other.pointer->retain();
+            this->reset();
+            this->pointer = other.pointer;
+        }
+
+        return *this;
+    }
+
+    auto operator=(IntrusivePointer &&other) noexcept -> IntrusivePointer & {
+        if (this != &other) {
+            this->reset();
+            this->pointer = std::exchange(other.pointer, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~IntrusivePointer() { this->reset(); }
+
+    auto reset() noexcept -> void {
+        if (this->pointer != nullptr) std::exchange(this->pointer, nullptr)->release();
+    }
+
+    [[nodiscard]] auto get() const noexcept -> T * { return this->pointer; }
+
+    [[nodiscard]] auto operator*() const noexcept -> T & { return *this->pointer; }
+
+    [[nodiscard]] auto operator->() const noexcept -> T * { return this->pointer; }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return this->pointer != nullptr; }
+
+    [[nodiscard]] auto operator==(std::nullptr_t) const noexcept -> bool { return this->pointer == nullptr; }
+
+private:
+    T *pointer{};
+};
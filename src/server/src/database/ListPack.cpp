@@ -0,0 +1,141 @@
+#include "ListPack.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+
+ListPack::Iterator::Iterator(const std::byte *const position) noexcept : position{position} {}
+
+auto ListPack::Iterator::operator*() const noexcept -> std::string_view {
+    const std::byte *source{this->position};
+    const unsigned long length{decodeLength(source)};
+
+    return {reinterpret_cast<const char *>(source), length};
+}
+
+auto ListPack::Iterator::operator++() noexcept -> Iterator & {
+    const unsigned long length{decodeLength(this->position)};
+    this->position += length;
+
+    return *this;
+}
+
+ListPack::ListPack(ListPack &&other) noexcept : data{std::exchange(other.data, nullptr)} {}
+
+auto ListPack::operator=(ListPack &&other) noexcept -> ListPack & {
+    if (this == &other) return *this;
+
+    std::free(this->data);
+    this->data = std::exchange(other.data, nullptr);
+
+    return *this;
+}
+
+ListPack::~ListPack() { std::free(this->data); }
+
+auto ListPack::begin() const noexcept -> Iterator { return Iterator{this->getPayload()}; }
+
+auto ListPack::end() const noexcept -> Iterator {
+    return Iterator{this->data == nullptr ? nullptr : this->getPayload() + this->getHeader().size};
+}
+
+auto ListPack::getCount() const noexcept -> unsigned long {
+    return this->data == nullptr ? 0 : this->getHeader().count;
+}
+
+auto ListPack::find(const std::string_view value, const unsigned long stride) const noexcept -> Iterator {
+    unsigned long index{};
+    for (Iterator iterator{this->begin()}; iterator != this->end(); ++iterator, ++index) {
+        if (index % stride == 0 && *iterator == value) return iterator;
+    }
+
+    return this->end();
+}
+
+auto ListPack::insert(const Iterator position, const std::string_view value) -> Iterator {
+    const unsigned long offset{this->getOffset(position)};
+
+    std::byte *const destination{this->splice(offset, 0, getLengthSize(value.size()) + value.size())};
+    std::memcpy(encodeLength(value.size(), destination), value.data(), value.size());
+    ++this->getHeader().count;
+
+    return Iterator{destination};
+}
+
+auto ListPack::replace(Iterator position, const std::string_view value) -> void {
+    const unsigned long offset{this->getOffset(position)};
+    const unsigned long oldSize{static_cast<unsigned long>((++position).position - (this->getPayload() + offset))};
+
+    std::byte *const destination{this->splice(offset, oldSize, getLengthSize(value.size()) + value.size())};
+    std::memcpy(encodeLength(value.size(), destination), value.data(), value.size());
+}
+
+auto ListPack::erase(const Iterator position, const unsigned long count) noexcept -> void {
+    if (count == 0) return;
+
+    Iterator last{position};
+    for (unsigned long i{}; i != count; ++i) ++last;
+
+    const unsigned long offset{this->getOffset(position)};
+    this->splice(offset, static_cast<unsigned long>(last.position - position.position), 0);
+    this->getHeader().count -= static_cast<unsigned int>(count);
+}
+
+auto ListPack::getLengthSize(unsigned long length) noexcept -> unsigned long {
+    unsigned long size{1};
+    for (; length >= 0x80; length >>= 7) ++size;
+
+    return size;
+}
+
+auto ListPack::encodeLength(unsigned long length, std::byte *destination) noexcept -> std::byte * {
+    for (; length >= 0x80; length >>= 7) *destination++ = static_cast<std::byte>((length & 0x7F) | 0x80);
+    *destination++ = static_cast<std::byte>(length);
+
+    return destination;
+}
+
+auto ListPack::decodeLength(const std::byte *&source) noexcept -> unsigned long {
+    unsigned long length{};
+    for (unsigned int shift{};; shift += 7) {
+        const auto byte{std::to_integer<unsigned long>(*source++)};
+        length |= (byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0) return length;
+    }
+}
+
+auto ListPack::getHeader() const noexcept -> Header & { return *reinterpret_cast<Header *>(this->data); }
+
+auto ListPack::getPayload() const noexcept -> std::byte * {
+    return this->data == nullptr ? nullptr : this->data + sizeof(Header);
+}
+
+auto ListPack::getOffset(const Iterator position) const noexcept -> unsigned long {
+    return this->data == nullptr ? 0 : static_cast<unsigned long>(position.position - this->getPayload());
+}
+
+auto ListPack::splice(const unsigned long offset, const unsigned long removeSize, const unsigned long insertSize)
+    -> std::byte * {
+    const unsigned long oldSize{this->data == nullptr ? 0 : this->getHeader().size},
+        newSize{oldSize - removeSize + insertSize};
+
+    if (const unsigned long capacity{this->data == nullptr ? 0 : this->getHeader().capacity}; newSize > capacity) {
+        const unsigned long newCapacity{std::max(newSize, capacity + capacity / 2)};
+
+        auto *const data{static_cast<std::byte *>(std::realloc(this->data, sizeof(Header) + newCapacity))};
+        if (data == nullptr) throw std::bad_alloc{};
+
+        if (this->data == nullptr) *reinterpret_cast<Header *>(data) = Header{};
+        this->data = data;
+        this->getHeader().capacity = static_cast<unsigned int>(newCapacity);
+    }
+
+    std::byte *const position{this->getPayload() + offset};
+    std::memmove(position + insertSize, position + removeSize, oldSize - offset - removeSize);
+    this->getHeader().size = static_cast<unsigned int>(newSize);
+
+    return position;
+}
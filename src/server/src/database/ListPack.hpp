@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+class ListPack {
+    struct Header {
+        unsigned int size, capacity, count;
+    };
+
+public:
+    class Iterator {
+    public:
+        explicit Iterator(const std::byte *position = nullptr) noexcept;
+
+        [[nodiscard]] auto operator*() const noexcept -> std::string_view;
+
+        auto operator++() noexcept -> Iterator &;
+
+        [[nodiscard]] auto operator==(const Iterator &) const noexcept -> bool = default;
+
+    private:
+        friend ListPack;
+
+        const std::byte *position;
+    };
+
+    ListPack() = default;
+
+    ListPack(const ListPack &) = delete;
+
+    ListPack(ListPack &&) noexcept;
+
+    auto operator=(const ListPack &) -> ListPack & = delete;
+
+    auto operator=(ListPack &&) noexcept -> ListPack &;
+
+    ~ListPack();
+
+    [[nodiscard]] auto begin() const noexcept -> Iterator;
+
+    [[nodiscard]] auto end() const noexcept -> Iterator;
+
+    [[nodiscard]] auto getCount() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto find(std::string_view value, unsigned long stride = 1) const noexcept -> Iterator;
+
+    auto insert(Iterator position, std::string_view value) -> Iterator;
+
+    auto replace(Iterator position, std::string_view value) -> void;
+
+    auto erase(Iterator position, unsigned long count = 1) noexcept -> void;
+
+private:
+    [[nodiscard]] static auto getLengthSize(unsigned long length) noexcept -> unsigned long;
+
+    static auto encodeLength(unsigned long length, std::byte *destination) noexcept -> std::byte *;
+
+    [[nodiscard]] static auto decodeLength(const std::byte *&source) noexcept -> unsigned long;
+
+    [[nodiscard]] auto getHeader() const noexcept -> Header &;
+
+    [[nodiscard]] auto getPayload() const noexcept -> std::byte *;
+
+    [[nodiscard]] auto getOffset(Iterator position) const noexcept -> unsigned long;
+
+    auto splice(unsigned long offset, unsigned long removeSize, unsigned long insertSize) -> std::byte *;
+
+    std::byte *data{};
+};
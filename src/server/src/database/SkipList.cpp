@@ -2,113 +2,197 @@
 
 #include "Entry.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <new>
 #include <random>
-#include <ranges>
 #include <utility>
 
-SkipList::SkipList(std::span<const std::byte> serialization) {
-    while (!serialization.empty()) {
-        const auto size{*reinterpret_cast<const unsigned long *>(serialization.data())};
-        serialization = serialization.subspan(sizeof(size));
+auto SkipList::Node::getNexts() noexcept -> Node ** { return reinterpret_cast<Node **>(this + 1); }
 
-        this->insert(std::make_shared<Entry>(serialization.first(size)));
-        serialization = serialization.subspan(size);
-    }
+auto SkipList::Node::getNexts() const noexcept -> Node *const * { return reinterpret_cast<Node *const *>(this + 1); }
+
+auto SkipList::Node::getSpans() noexcept -> unsigned long * {
+    return reinterpret_cast<unsigned long *>(this->getNexts() + this->height);
+}
+
+auto SkipList::Node::getSpans() const noexcept -> const unsigned long * {
+    return reinterpret_cast<const unsigned long *>(this->getNexts() + this->height);
 }
 
-SkipList::SkipList(const SkipList &other) : levels{other.copy()} {}
+SkipList::SkipList() : head{this->createNode(nullptr, 0, maxHeight)} {}
 
-SkipList::SkipList(SkipList &&other) noexcept : levels{std::exchange(other.levels, std::array<Node *, 32>{})} {}
+SkipList::SkipList(SkipList &&other) noexcept :
+    arena{std::move(other.arena)}, head{std::exchange(other.head, nullptr)}, size{std::exchange(other.size, 0)},
+    height{std::exchange(other.height, 1)} {}
 
-auto SkipList::operator=(const SkipList &other) -> SkipList & {
+auto SkipList::operator=(SkipList &&other) noexcept -> SkipList & {
     if (this == &other) return *this;
 
     this->destroy();
 
-    this->levels = other.copy();
+    this->arena = std::move(other.arena);
+    this->head = std::exchange(other.head, nullptr);
+    this->size = std::exchange(other.size, 0);
+    this->height = std::exchange(other.height, 1);
 
     return *this;
 }
 
-auto SkipList::operator=(SkipList &&other) noexcept -> SkipList & {
-    if (this == &other) return *this;
+SkipList::~SkipList() { this->destroy(); }
 
-    this->destroy();
+auto SkipList::find(const std::string_view key) const noexcept -> IntrusivePointer<Entry> {
+    const unsigned long prefix{getPrefix(key)};
 
-    this->levels = std::exchange(other.levels, std::array<Node *, 32>{});
+    const Node *node{this->head};
+    for (unsigned char level{this->height}; level-- != 0;) {
+        for (const Node *next{node->getNexts()[level]}; next != nullptr; next = node->getNexts()[level]) {
+            __builtin_prefetch(next->getNexts()[level]);
 
-    return *this;
+            const std::strong_ordering order{compare(next, key, prefix)};
+            if (order == 0) return next->entry;
+            if (order > 0) break;
+
+            node = next;
+        }
+    }
+
+    return nullptr;
 }
 
-SkipList::~SkipList() { this->destroy(); }
+auto SkipList::getSize() const noexcept -> unsigned long { return this->size; }
 
-auto SkipList::find(const std::string_view key) const noexcept -> std::shared_ptr<Entry> {
-    Node *node{this->levels.back()};
-    while (node != nullptr) {
-        Node *const next{node->next}, *const down{node->down};
+auto SkipList::select(const unsigned long rank) const noexcept -> IntrusivePointer<Entry> {
+    if (rank >= this->size) return nullptr;
 
-        if (key == node->entry->getKey()) return node->entry;
+    const Node *node{this->head};
+    unsigned long traversed{};
+    for (unsigned char level{this->height}; level-- != 0;) {
+        for (const Node *next{node->getNexts()[level]};
+             next != nullptr && traversed + node->getSpans()[level] <= rank + 1; next = node->getNexts()[level]) {
+            traversed += node->getSpans()[level];
+            node = next;
+        }
 
-        if (next != nullptr && key >= next->entry->getKey()) node = next;
-        else node = down;
+        if (traversed == rank + 1) return node->entry;
     }
 
     return nullptr;
 }
 
-auto SkipList::insert(const std::shared_ptr<Entry> &entry) const -> void {
-    const std::string_view key{entry->getKey()};
-    Node *previous{};
-    for (Node *node{this->levels[this->randomLevel()]}; node != nullptr; node = node->down) {
-        while (node->next != nullptr && key >= node->next->entry->getKey()) node = node->next;
+auto SkipList::getRank(const std::string_view key) const noexcept -> std::optional<unsigned long> {
+    const unsigned long prefix{getPrefix(key)};
+
+    const Node *node{this->head};
+    unsigned long traversed{};
+    for (unsigned char level{this->height}; level-- != 0;) {
+        for (const Node *next{node->getNexts()[level]}; next != nullptr; next = node->getNexts()[level]) {
+            const std::strong_ordering order{compare(next, key, prefix)};
+            if (order > 0) break;
 
-        if (key != node->entry->getKey()) {
-            node->next = new Node{entry, node->next};
+            traversed += node->getSpans()[level];
+            if (order == 0) return traversed - 1;
 
-            if (previous != nullptr) previous->down = node->next;
-            previous = node->next;
-        } else node->entry = entry;
+            node = next;
+        }
     }
+
+    return std::nullopt;
 }
 
-auto SkipList::erase(const std::string_view key) const noexcept -> bool {
-    bool isSuccess{};
+auto SkipList::insert(const IntrusivePointer<Entry> &entry) -> void {
+    const std::string_view key{entry->getKey()};
+    const unsigned long prefix{getPrefix(key)};
 
-    Node *node{this->levels.back()};
-    while (node != nullptr) {
-        while (node->next != nullptr && key > node->next->entry->getKey()) node = node->next;
+    std::array<Node *, maxHeight> updates;
+    std::array<unsigned long, maxHeight> ranks;
+    Node *node{this->head};
+    for (unsigned char level{this->height}; level-- != 0;) {
+        ranks[level] = level + 1 != this->height ? ranks[level + 1] : 0;
 
-        Node *const down{node->down};
-        if (const Node *const next{node->next}; next != nullptr && key == next->entry->getKey()) {
-            const Node *const deleteNode{next};
-            node->next = next->next;
-            delete deleteNode;
+        for (Node *next{node->getNexts()[level]}; next != nullptr && compare(next, key, prefix) < 0;
+             next = node->getNexts()[level]) {
+            __builtin_prefetch(next->getNexts()[level]);
 
-            isSuccess = true;
+            ranks[level] += node->getSpans()[level];
+            node = next;
         }
 
-        node = down;
+        updates[level] = node;
     }
 
-    return isSuccess;
+    if (Node *const next{node->getNexts()[0]}; next != nullptr && compare(next, key, prefix) == 0) {
+        next->entry = entry;
+
+        return;
+    }
+
+    const unsigned char height{randomHeight()};
+    for (; this->height < height; ++this->height) {
+        updates[this->height] = this->head;
+        ranks[this->height] = 0;
+        this->head->getSpans()[this->height] = this->size;
+    }
+
+    Node *const newNode{this->createNode(entry, prefix, height)};
+    for (unsigned char level{}; level != height; ++level) {
+        newNode->getNexts()[level] = updates[level]->getNexts()[level];
+        updates[level]->getNexts()[level] = newNode;
+
+        newNode->getSpans()[level] = updates[level]->getSpans()[level] - (ranks[0] - ranks[level]);
+        updates[level]->getSpans()[level] = ranks[0] - ranks[level] + 1;
+    }
+    for (unsigned char level{height}; level < this->height; ++level) ++updates[level]->getSpans()[level];
+
+    ++this->size;
 }
 
-auto SkipList::clear() noexcept -> void {
-    for (Node *&level : this->levels) {
-        const Node *node{level->next};
-        while (node != nullptr) {
-            const Node *const next{node->next};
-            delete node;
+auto SkipList::erase(const std::string_view key) noexcept -> bool {
+    const unsigned long prefix{getPrefix(key)};
+
+    std::array<Node *, maxHeight> updates;
+    Node *node{this->head};
+    for (unsigned char level{this->height}; level-- != 0;) {
+        for (Node *next{node->getNexts()[level]}; next != nullptr && compare(next, key, prefix) < 0;
+             next = node->getNexts()[level])
             node = next;
-        }
 
-        level->next = nullptr;
+        updates[level] = node;
     }
+
+    Node *const target{node->getNexts()[0]};
+    if (target == nullptr || compare(target, key, prefix) != 0) return false;
+
+    for (unsigned char level{}; level != this->height; ++level) {
+        if (updates[level]->getNexts()[level] == target) {
+            updates[level]->getSpans()[level] += target->getSpans()[level] - 1;
+            updates[level]->getNexts()[level] = target->getNexts()[level];
+        } else --updates[level]->getSpans()[level];
+    }
+    this->destroyNode(target);
+    --this->size;
+
+    while (this->height > 1 && this->head->getNexts()[this->height - 1] == nullptr) --this->height;
+
+    return true;
+}
+
+auto SkipList::clear() noexcept -> void {
+    for (Node *node{this->head->getNexts()[0]}; node != nullptr;) {
+        Node *const next{node->getNexts()[0]};
+        this->destroyNode(node);
+        node = next;
+    }
+
+    std::fill_n(this->head->getNexts(), maxHeight, nullptr);
+    std::fill_n(this->head->getSpans(), maxHeight, 0);
+    this->size = 0;
+    this->height = 1;
 }
 
 auto SkipList::serialize() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
-    for (const Node *node{this->levels.front()->next}; node != nullptr; node = node->next) {
+    for (const Node *node{this->head->getNexts()[0]}; node != nullptr; node = node->getNexts()[0]) {
         const std::vector serializedEntry{node->entry->serialize()};
 
         const unsigned long size{serializedEntry.size()};
@@ -121,64 +205,56 @@ auto SkipList::serialize() const -> std::vector<std::byte> {
     return serialization;
 }
 
-auto SkipList::initialize() -> std::array<Node *, 32> {
-    std::array<Node *, 32> levels;
-
-    for (Node *previous{}; auto &level : levels | std::views::reverse) {
-        level = new Node{std::make_shared<Entry>(std::string{}, std::string{})};
-
-        if (previous != nullptr) previous->down = level;
-        previous = level;
+auto SkipList::getPrefix(const std::string_view key) noexcept -> unsigned long {
+    unsigned long prefix{};
+    for (unsigned char i{}; i != sizeof(prefix); ++i) {
+        prefix <<= 8;
+        if (i < key.size()) prefix |= static_cast<unsigned char>(key[i]);
     }
 
-    return levels;
+    return prefix;
 }
 
-auto SkipList::copy() const -> std::array<Node *, 32> {
-    std::array<Node *, 32> copies;
+auto SkipList::compare(const Node *const node, const std::string_view key, const unsigned long prefix) noexcept
+    -> std::strong_ordering {
+    if (node->prefix != prefix) return node->prefix <=> prefix;
 
-    for (unsigned char i{}; i != this->levels.size(); ++i) {
-        Node *previous{};
-        for (const Node *node{this->levels[i]}; node != nullptr; node = node->next) {
-            const auto newNode{new Node{std::make_shared<Entry>(*node->entry)}};
+    return node->entry->getKey() <=> key;
+}
 
-            if (previous != nullptr) previous->next = newNode;
-            else copies[i] = newNode;
-            previous = newNode;
-        }
-    }
-    for (auto up{copies.crbegin()}, down{up + 1}; down != copies.crend(); ++up, ++down) {
-        for (Node *upNode{*up}, *downNode{*down}; upNode != nullptr; downNode = downNode->next) {
-            if (upNode->entry->getKey() == downNode->entry->getKey()) {
-                upNode->down = downNode;
-                upNode = upNode->next;
-            }
-        }
-    }
+auto SkipList::randomHeight() -> unsigned char {
+    thread_local unsigned long state{std::random_device{}() | 1UL};
 
-    return copies;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return static_cast<unsigned char>(std::min(std::countr_zero(state) + 1, static_cast<int>(maxHeight)));
 }
 
-auto SkipList::destroy() const noexcept -> void {
-    for (const Node *level : this->levels) {
-        while (level != nullptr) {
-            const Node *const next{level->next};
-            delete level;
-            level = next;
-        }
-    }
+constexpr auto SkipList::getNodeSize(const unsigned char height) noexcept -> unsigned long {
+    return sizeof(Node) + height * (sizeof(Node *) + sizeof(unsigned long));
 }
 
-[[nodiscard]] constexpr auto randomZeroOne() -> int {
-    static std::mt19937 generator{std::random_device{}()};
-    static std::uniform_int_distribution distribution{0, 1};
+auto SkipList::createNode(IntrusivePointer<Entry> entry, const unsigned long prefix, const unsigned char height)
+    -> Node * {
+    void *const memory{this->arena.allocate(getNodeSize(height))};
+    auto *const node{new (memory) Node{std::move(entry), prefix, height}};
+    std::fill_n(node->getNexts(), height, nullptr);
+    std::fill_n(node->getSpans(), height, 0);
+
+    return node;
+}
 
-    return distribution(generator);
+auto SkipList::destroyNode(Node *const node) noexcept -> void {
+    const unsigned long size{getNodeSize(node->height)};
+    node->~Node();
+    this->arena.deallocate(node, size);
 }
 
-auto SkipList::randomLevel() const -> unsigned char {
-    unsigned char level{};
-    while (randomZeroOne() == 0 && level != this->levels.size()) ++level;
+auto SkipList::destroy() noexcept -> void {
+    if (this->head == nullptr) return;
 
-    return level;
+    this->clear();
+    this->destroyNode(std::exchange(this->head, nullptr));
 }
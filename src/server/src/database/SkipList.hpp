@@ -1,49 +1,77 @@
 #pragma once
 
-#include <memory>
-#include <vector>
+#include "Arena.hpp"
+#include "IntrusivePointer.hpp"
+
+#include <optional>
+#include <string_view>
 
 class Entry;
 
 class SkipList {
     struct Node {
-        std::shared_ptr<Entry> entry;
-        Node *next{}, *down{};
+        [[nodiscard]] auto getNexts() noexcept -> Node **;
+
+        [[nodiscard]] auto getNexts() const noexcept -> Node *const *;
+
+        [[nodiscard]] auto getSpans() noexcept -> unsigned long *;
+
+        [[nodiscard]] auto getSpans() const noexcept -> const unsigned long *;
+
+        IntrusivePointer<Entry> entry;
+        unsigned long prefix;
+        unsigned char height;
     };
 
 public:
-    constexpr SkipList() = default;
-
-    explicit SkipList(std::span<const std::byte> serialization);
+    SkipList();
 
-    SkipList(const SkipList &);
+    SkipList(const SkipList &) = delete;
 
     SkipList(SkipList &&) noexcept;
 
-    auto operator=(const SkipList &) -> SkipList &;
+    auto operator=(const SkipList &) -> SkipList & = delete;
 
     auto operator=(SkipList &&) noexcept -> SkipList &;
 
     ~SkipList();
 
-    [[nodiscard]] auto find(std::string_view key) const noexcept -> std::shared_ptr<Entry>;
+    [[nodiscard]] auto find(std::string_view key) const noexcept -> IntrusivePointer<Entry>;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
 
-    auto insert(const std::shared_ptr<Entry> &entry) const -> void;
+    [[nodiscard]] auto select(unsigned long rank) const noexcept -> IntrusivePointer<Entry>;
 
-    auto erase(std::string_view key) const noexcept -> bool;
+    [[nodiscard]] auto getRank(std::string_view key) const noexcept -> std::optional<unsigned long>;
+
+    auto insert(const IntrusivePointer<Entry> &entry) -> void;
+
+    auto erase(std::string_view key) noexcept -> bool;
 
     auto clear() noexcept -> void;
 
     [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
 
 private:
-    [[nodiscard]] static auto initialize() -> std::array<Node *, 32>;
+    static constexpr unsigned char maxHeight{32};
+
+    [[nodiscard]] static auto getPrefix(std::string_view key) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto compare(const Node *node, std::string_view key, unsigned long prefix) noexcept
+        -> std::strong_ordering;
+
+    [[nodiscard]] static auto randomHeight() -> unsigned char;
+
+    [[nodiscard]] static constexpr auto getNodeSize(unsigned char height) noexcept -> unsigned long;
 
-    [[nodiscard]] auto copy() const -> std::array<Node *, 32>;
+    [[nodiscard]] auto createNode(IntrusivePointer<Entry> entry, unsigned long prefix, unsigned char height) -> Node *;
 
-    auto destroy() const noexcept -> void;
+    auto destroyNode(Node *node) noexcept -> void;
 
-    [[nodiscard]] auto randomLevel() const -> unsigned char;
+    auto destroy() noexcept -> void;
 
-    std::array<Node *, 32> levels{initialize()};
+    Arena arena;
+    Node *head;
+    unsigned long size{};
+    unsigned char height{1};
 };
@@ -1,28 +1,214 @@
 #include "Client.hpp"
 
+#include "../../../common/Reply.hpp"
+#include "../protocol/Output.hpp"
+#include "../protocol/Resp.hpp"
+
+#include <algorithm>
 #include <linux/io_uring.h>
+#include <utility>
 
-Client::Client(const int fileDescriptor) noexcept : FileDescriptor{fileDescriptor} {}
+Client::Client(const int fileDescriptor, const unsigned long id) noexcept : FileDescriptor{fileDescriptor}, id{id} {}
 
-auto Client::receive(const int ringBufferId) const noexcept -> Awaiter {
+auto Client::receive(const int ringBufferId, const bool isBundle) const noexcept -> Awaiter {
     return Awaiter{
         Submission{
                    this->getFileDescriptor(),
                    IOSQE_FIXED_FILE | IOSQE_BUFFER_SELECT,
-                   IORING_RECVSEND_POLL_FIRST, 0,
+                   static_cast<unsigned short>(IORING_RECVSEND_POLL_FIRST | (isBundle ? IORING_RECVSEND_BUNDLE : 0)), 0,
                    Submission::Receive{std::span<std::byte>{}, 0, ringBufferId},
                    }
     };
 }
 
-auto Client::send(const std::span<const std::byte> data) const noexcept -> Awaiter {
+auto Client::send(const __kernel_timespec *const timeout) -> Awaiter {
+    this->prepareSend();
+
+    if (this->fixedBufferIndex != -1) {
+        return Awaiter{
+            Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, 0,
+                       Submission::Send{this->fixedBuffer.first(this->fixedSize), 0, timeout}}
+        };
+    }
+
+    return Awaiter{
+        Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, 0, Submission::Send{this->sendBuffer, 0, timeout}}
+    };
+}
+
+auto Client::sendZeroCopy(const __kernel_timespec *const timeout) -> Awaiter {
+    this->prepareSend();
+
+    if (this->fixedBufferIndex == -1) {
+        return Awaiter{
+            Submission{
+                       this->getFileDescriptor(),
+                       IOSQE_FIXED_FILE, 0,
+                       0, Submission::SendZeroCopy{this->sendBuffer, 0, 0, -1, timeout},
+                       }
+        };
+    }
+
     return Awaiter{
         Submission{
                    this->getFileDescriptor(),
                    IOSQE_FIXED_FILE, 0,
-                   0, Submission::Send{data, 0, 0},
+                   0, Submission::SendZeroCopy{
+                   this->fixedBuffer.first(this->fixedSize), 0, IORING_RECVSEND_FIXED_BUF, this->fixedBufferIndex,
+                   timeout},
                    }
     };
 }
 
+auto Client::cancel() const noexcept -> Awaiter {
+    return Awaiter{
+        Submission{this->getFileDescriptor(), 0, 0, 0,
+                   Submission::Cancel{
+                       0, IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL | IORING_ASYNC_CANCEL_FD_FIXED}}
+    };
+}
+
+auto Client::cancelReceive() const noexcept -> Awaiter {
+    return Awaiter{
+        Submission{this->getFileDescriptor(), 0, 0, 0, Submission::Cancel{this->receiveUserData, 0}}
+    };
+}
+
+auto Client::migrate(const int ringFileDescriptor, const unsigned long data) const noexcept -> Awaiter {
+    return Awaiter{
+        Submission{
+                   ringFileDescriptor, 0,
+                   0, 0,
+                   Submission::MessageFileDescriptor{this->getFileDescriptor(), data},
+                   }
+    };
+}
+
+auto Client::push(const Reply &reply) -> void {
+    Output output{this->fixedBufferIndex != -1 && !this->isSending ? this->fixedBuffer.subspan(this->fixedSize) :
+                                                                     std::span<std::byte>{},
+                  this->writeBuffer};
+    if (this->parser.getProtocol() == Parser::Protocol::resp)
+        Resp::serialize(reply, this->context.getProtocolVersion(), output);
+    else output.write(reply.serialize());
+
+    this->fixedSize += output.getSize();
+}
+
+auto Client::attach(const std::span<std::byte> fixedBuffer, const int fixedBufferIndex) noexcept -> void {
+    this->fixedBuffer = fixedBuffer;
+    this->fixedBufferIndex = fixedBufferIndex;
+}
+
+auto Client::detach() noexcept -> int {
+    this->fixedBuffer = {};
+    this->fixedSize = 0;
+
+    return std::exchange(this->fixedBufferIndex, -1);
+}
+
+auto Client::getFixedBufferIndex() const noexcept -> int { return this->fixedBufferIndex; }
+
+auto Client::isWritable() const noexcept -> bool {
+    return !this->isSending && (this->fixedSize != 0 || !this->writeBuffer.empty() || !this->sendBuffer.empty());
+}
+
+auto Client::getWriteSize() const noexcept -> unsigned long {
+    return this->fixedSize + this->writeBuffer.size() + this->sendBuffer.size();
+}
+
+auto Client::getQuerySize() const noexcept -> unsigned long { return this->parser.getSize(); }
+
+auto Client::sent(const unsigned long size) -> void {
+    if (this->fixedBufferIndex != -1) {
+        if (size < this->fixedSize) {
+            this->sendBuffer.insert(this->sendBuffer.cbegin(), this->fixedBuffer.begin() + static_cast<long>(size),
+                                    this->fixedBuffer.begin() + static_cast<long>(this->fixedSize));
+        }
+        static_cast<void>(this->detach());
+    } else if (size >= this->sendBuffer.size()) this->sendBuffer.clear();
+    else this->sendBuffer.erase(this->sendBuffer.cbegin(), this->sendBuffer.cbegin() + static_cast<long>(size));
+
+    this->isSending = false;
+}
+
+auto Client::prepareSend() -> void {
+    this->isSending = true;
+    if (this->fixedBufferIndex != -1) return;
+
+    if (this->sendBuffer.empty()) std::swap(this->sendBuffer, this->writeBuffer);
+    else {
+        this->sendBuffer.insert(this->sendBuffer.cend(), this->writeBuffer.cbegin(), this->writeBuffer.cend());
+        this->writeBuffer.clear();
+    }
+}
+
+auto Client::getIsReceiving() const noexcept -> bool { return this->isReceiving; }
+
+auto Client::setIsReceiving(const bool isReceiving) noexcept -> void { this->isReceiving = isReceiving; }
+
+auto Client::getIsSending() const noexcept -> bool { return this->isSending; }
+
+auto Client::getId() const noexcept -> unsigned long { return this->id; }
+
+auto Client::getActiveTime() const noexcept -> unsigned long { return this->activeTime; }
+
+auto Client::setActiveTime(const unsigned long activeTime) noexcept -> void { this->activeTime = activeTime; }
+
+auto Client::getReceiveUserData() const noexcept -> unsigned long { return this->receiveUserData; }
+
+auto Client::setReceiveUserData(const unsigned long receiveUserData) noexcept -> void {
+    this->receiveUserData = receiveUserData;
+}
+
+auto Client::getIsPaused() const noexcept -> bool { return this->isPaused; }
+
+auto Client::setIsPaused(const bool isPaused) noexcept -> void { this->isPaused = isPaused; }
+
+auto Client::getIsForwarding() const noexcept -> bool { return this->isForwarding; }
+
+auto Client::setIsForwarding(const bool isForwarding) noexcept -> void { this->isForwarding = isForwarding; }
+
+auto Client::getIsBulk() const noexcept -> bool { return this->isBulk; }
+
+auto Client::setIsBulk(const bool isBulk) noexcept -> void { this->isBulk = isBulk; }
+
+auto Client::getIsClosing() const noexcept -> bool { return this->isClosing; }
+
+auto Client::setIsClosing(const bool isClosing) noexcept -> void { this->isClosing = isClosing; }
+
+auto Client::getIsDeferred() const noexcept -> bool { return this->isDeferred; }
+
+auto Client::setIsDeferred(const bool isDeferred) noexcept -> void { this->isDeferred = isDeferred; }
+
+auto Client::getIsMigrating() const noexcept -> bool { return this->isMigrating; }
+
+auto Client::setIsMigrating(const bool isMigrating) noexcept -> void { this->isMigrating = isMigrating; }
+
+auto Client::charge(const unsigned long frame, const unsigned long size) noexcept -> void {
+    if (this->budgetFrame != frame) {
+        this->budgetFrame = frame;
+        this->commandCount = 0;
+        this->byteCount = 0;
+    }
+
+    ++this->commandCount;
+    ++this->commandRate;
+    this->byteCount += size;
+}
+
+auto Client::getCommandCount(const unsigned long frame) const noexcept -> unsigned long {
+    return this->budgetFrame == frame ? this->commandCount : 0;
+}
+
+auto Client::getByteCount(const unsigned long frame) const noexcept -> unsigned long {
+    return this->budgetFrame == frame ? this->byteCount : 0;
+}
+
+auto Client::getCommandRate() const noexcept -> unsigned long { return this->commandRate; }
+
+auto Client::resetCommandRate() noexcept -> void { this->commandRate = 0; }
+
 auto Client::getContext() noexcept -> Context & { return this->context; }
+
+auto Client::getParser() noexcept -> Parser & { return this->parser; }
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "../database/Context.hpp"
+#include "../protocol/Parser.hpp"
 #include "FileDescriptor.hpp"
 
+class Reply;
+struct __kernel_timespec;
+
 class Client final : public FileDescriptor {
 public:
-    explicit Client(int fileDescriptor) noexcept;
+    Client(int fileDescriptor, unsigned long id) noexcept;
 
     Client(const Client &) = delete;
 
@@ -17,12 +21,98 @@ public:
 
     constexpr ~Client() override = default;
 
-    [[nodiscard]] auto receive(int ringBufferId) const noexcept -> Awaiter;
+    [[nodiscard]] auto receive(int ringBufferId, bool isBundle) const noexcept -> Awaiter;
+
+    [[nodiscard]] auto send(const __kernel_timespec *timeout) -> Awaiter;
+
+    [[nodiscard]] auto sendZeroCopy(const __kernel_timespec *timeout) -> Awaiter;
+
+    [[nodiscard]] auto cancel() const noexcept -> Awaiter;
+
+    [[nodiscard]] auto cancelReceive() const noexcept -> Awaiter;
+
+    [[nodiscard]] auto migrate(int ringFileDescriptor, unsigned long data) const noexcept -> Awaiter;
+
+    auto push(const Reply &reply) -> void;
+
+    auto attach(std::span<std::byte> fixedBuffer, int fixedBufferIndex) noexcept -> void;
+
+    [[nodiscard]] auto detach() noexcept -> int;
+
+    [[nodiscard]] auto getFixedBufferIndex() const noexcept -> int;
+
+    [[nodiscard]] auto isWritable() const noexcept -> bool;
+
+    [[nodiscard]] auto getWriteSize() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getQuerySize() const noexcept -> unsigned long;
+
+    auto sent(unsigned long size) -> void;
+
+    [[nodiscard]] auto getIsReceiving() const noexcept -> bool;
+
+    auto setIsReceiving(bool isReceiving) noexcept -> void;
+
+    [[nodiscard]] auto getIsSending() const noexcept -> bool;
+
+    [[nodiscard]] auto getId() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getActiveTime() const noexcept -> unsigned long;
+
+    auto setActiveTime(unsigned long activeTime) noexcept -> void;
 
-    [[nodiscard]] auto send(std::span<const std::byte> data) const noexcept -> Awaiter;
+    [[nodiscard]] auto getReceiveUserData() const noexcept -> unsigned long;
+
+    auto setReceiveUserData(unsigned long receiveUserData) noexcept -> void;
+
+    [[nodiscard]] auto getIsPaused() const noexcept -> bool;
+
+    auto setIsPaused(bool isPaused) noexcept -> void;
+
+    [[nodiscard]] auto getIsForwarding() const noexcept -> bool;
+
+    auto setIsForwarding(bool isForwarding) noexcept -> void;
+
+    [[nodiscard]] auto getIsBulk() const noexcept -> bool;
+
+    auto setIsBulk(bool isBulk) noexcept -> void;
+
+    [[nodiscard]] auto getIsClosing() const noexcept -> bool;
+
+    auto setIsClosing(bool isClosing) noexcept -> void;
+
+    [[nodiscard]] auto getIsDeferred() const noexcept -> bool;
+
+    auto setIsDeferred(bool isDeferred) noexcept -> void;
+
+    [[nodiscard]] auto getIsMigrating() const noexcept -> bool;
+
+    auto setIsMigrating(bool isMigrating) noexcept -> void;
+
+    auto charge(unsigned long frame, unsigned long size) noexcept -> void;
+
+    [[nodiscard]] auto getCommandCount(unsigned long frame) const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getByteCount(unsigned long frame) const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getCommandRate() const noexcept -> unsigned long;
+
+    auto resetCommandRate() noexcept -> void;
 
     [[nodiscard]] auto getContext() noexcept -> Context &;
 
+    [[nodiscard]] auto getParser() noexcept -> Parser &;
+
 private:
+    auto prepareSend() -> void;
+
     Context context;
+    Parser parser;
+    std::vector<std::byte> writeBuffer, sendBuffer;
+    std::span<std::byte> fixedBuffer;
+    unsigned long id, activeTime{}, receiveUserData{}, budgetFrame{}, commandCount{}, byteCount{},
+        commandRate{}, fixedSize{};
+    int fixedBufferIndex{-1};
+    bool isReceiving{}, isSending{}, isPaused{}, isForwarding{}, isBulk{}, isClosing{}, isDeferred{},
+        isMigrating{};
 };
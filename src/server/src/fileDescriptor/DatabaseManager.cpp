@@ -3,11 +3,20 @@
 #include "../../../common/Exception.hpp"
 #include "../../../common/Reply.hpp"
 #include "../database/Context.hpp"
+#include "../database/Entry.hpp"
+#include "../statistics/Statistics.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fcntl.h>
 #include <filesystem>
+#include <format>
 #include <fstream>
+#include <limits>
 #include <linux/io_uring.h>
+#include <random>
+#include <utility>
 
 auto DatabaseManager::create(const std::source_location sourceLocation) -> int {
     const int fileDescriptor{open(filepath.data(), O_CREAT | O_WRONLY | O_APPEND | O_SYNC, S_IRUSR | S_IWUSR)};
@@ -29,19 +38,41 @@ auto DatabaseManager::create(const std::source_location sourceLocation) -> int {
     return fileDescriptor;
 }
 
-DatabaseManager::DatabaseManager(const int fileDescriptor) : FileDescriptor{fileDescriptor} {
-    for (unsigned long i{}; i != databaseCount; ++i) this->databases.emplace_back(i, std::span<const std::byte>{});
+DatabaseManager::DatabaseManager(const int fileDescriptor, const unsigned long shardCount,
+                                 const unsigned long listPackMaxEntries, const unsigned long listPackMaxValue) :
+    FileDescriptor{fileDescriptor}, journals(shardCount), snapshots(shardCount), generations(shardCount),
+    shardCount{shardCount} {
+    Entry::setListPackLimit(listPackMaxEntries, listPackMaxValue);
+
+    for (unsigned long i{}; i != shardCount * databaseCount; ++i)
+        this->databases.emplace_back(i % databaseCount, std::span<const std::byte>{});
 
     if (std::ifstream file{filepath}; file.is_open()) {
         std::vector<std::byte> buffer{std::filesystem::file_size(filepath)};
         file.read(reinterpret_cast<char *>(buffer.data()), static_cast<long>(buffer.size()));
         std::span<const std::byte> bufferSpan{buffer};
 
-        for (unsigned long i{}; i != this->databases.size(); ++i) {
+        for (unsigned long i{}; i != databaseCount; ++i) {
             const auto size{*reinterpret_cast<const unsigned long *>(bufferSpan.data())};
             bufferSpan = bufferSpan.subspan(sizeof(size));
 
-            this->databases[i] = Database{i, bufferSpan.first(size)};
+            std::span data{bufferSpan.first(size)};
+            if (shardCount == 1) this->databases[i] = Database{i, data};
+            else {
+                std::vector<std::vector<std::byte>> shardData{shardCount};
+                while (!data.empty()) {
+                    const auto entrySize{*reinterpret_cast<const unsigned long *>(data.data())};
+                    const std::span entry{data.first(sizeof(entrySize) + entrySize)};
+
+                    std::vector<std::byte> &target{
+                        shardData[this->getShard(Entry::getKey(entry.subspan(sizeof(entrySize))))]};
+                    target.insert(target.cend(), entry.begin(), entry.end());
+                    data = data.subspan(entry.size());
+                }
+
+                for (unsigned long j{}; j != shardCount; ++j)
+                    this->databases[j * databaseCount + i] = Database{i, shardData[j]};
+            }
             bufferSpan = bufferSpan.subspan(size);
         }
 
@@ -53,19 +84,41 @@ DatabaseManager::DatabaseManager(const int fileDescriptor) : FileDescriptor{file
             this->query(context, Answer{bufferSpan.first(size)});
             bufferSpan = bufferSpan.subspan(size);
         }
+
+        for (Journal &journal : this->journals) {
+            journal.buffer.clear();
+            journal.count = 0;
+            journal.databaseIndex = databaseCount;
+        }
     }
 }
 
-auto DatabaseManager::query(Context &context, Answer &&answer) -> Reply {
+auto DatabaseManager::setClientHandler(Handler &&handler) noexcept -> void {
+    getClientHandler() = std::move(handler);
+}
+
+auto DatabaseManager::query(Context &context, Answer &&answer, const long shard) -> Reply {
     const unsigned long databaseIndex{context.getDatabaseIndex()};
 
-    std::string_view statement{answer.getStatement()}, command;
-    if (const unsigned long position{statement.find(' ')}; position != std::string_view::npos) {
-        command = statement.substr(0, position);
-        statement.remove_prefix(position + 1);
-    } else {
-        command = statement;
-        statement = std::string_view{};
+    const std::string_view command{answer.getCommand()};
+    const std::span arguments{answer.getArguments()};
+    if (!isArityValid(command, arguments.size())) {
+        return {Reply::Type::error, std::format("ERR wrong number of arguments for '{}' command", command),
+                databaseIndex, context.getIsTransaction()};
+    }
+
+    const std::vector keys{this->shardCount != 1 ? getKeys(command, arguments) : std::vector<std::string_view>{}};
+    const unsigned long keyShard{keys.empty() ? 0 : this->getShard(keys.front())};
+    const std::span databases{std::span{this->databases}.subspan(keyShard * databaseCount, databaseCount)};
+    const unsigned long first{shard == anyShard ? 0 : static_cast<unsigned long>(shard)},
+        last{shard == anyShard ? this->shardCount : first + 1};
+
+    std::shared_lock sharedLock{this->databaseLock, std::defer_lock};
+    std::unique_lock uniqueLock{this->databaseLock, std::defer_lock};
+    if (this->shardCount == 1 && command != "MULTI" && command != "EXEC" && command != "DISCARD" &&
+        !context.getIsTransaction()) {
+        if (isWrite(command)) uniqueLock.lock();
+        else sharedLock.lock();
     }
 
     Reply reply{Reply::Type::nil, 0};
@@ -74,283 +127,295 @@ auto DatabaseManager::query(Context &context, Answer &&answer) -> Reply {
     else if (command == "EXEC") reply = this->exec(context);
     else if (command == "DISCARD") reply = discard(context);
     else if (context.getIsTransaction()) reply = transaction(context, std::move(answer));
-    else if (command == "FLUSHALL") reply = flushAll();
+    else if (this->isCrossShard(keys)) {
+        reply = this->crossShard(databaseIndex, command, arguments, keys);
+        isRecord = reply.getType() != Reply::Type::error && (command == "DEL" || command == "MSET");
+    } else if (command == "PING") reply = ping(arguments);
+    else if (command == "HELLO") reply = hello(context, arguments);
+    else if (command == "CLIENT") reply = client(arguments);
+    else if (command == "INFO") reply = {Reply::Type::string, Statistics::toString()};
+    else if (command == "FLUSHALL") reply = this->flushAll(first, last);
     else if (command == "FLUSHDB") {
-        {
-            const std::shared_lock lockGuard{this->lock};
-
-            reply = this->databases[databaseIndex].flushDb();
-        }
-
-        isRecord = true;
-    } else if (command == "SELECT") {
-        reply = select(context, statement);
-        isRecord = true;
-    } else if (command == "DEL") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].del(statement);
-        }
-
+        for (unsigned long i{first}; i != last; ++i)
+            reply = this->databases[i * databaseCount + databaseIndex].flushDb();
+
+        isRecord = first == 0;
+    } else if (command == "DBSIZE") reply = this->dbSize(databaseIndex, first, last);
+    else if (command == "RANDOMKEY") reply = this->randomKey(databaseIndex, first, last);
+    else if (command == "SELECT") reply = select(context, arguments);
+    else if (command == "DEL") {
+        reply = databases[databaseIndex].del(arguments);
         isRecord = true;
-    } else if (command == "EXISTS") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].exists(statement);
-    } else if (command == "MOVE") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].move(this->databases, statement);
-        }
-
+    } else if (command == "EXISTS") reply = databases[databaseIndex].exists(arguments);
+    else if (command == "MOVE") {
+        reply = databases[databaseIndex].move(databases, arguments);
         isRecord = true;
     } else if (command == "RENAME") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].rename(statement);
-        }
-
+        reply = databases[databaseIndex].rename(arguments);
         isRecord = true;
     } else if (command == "RENAMENX") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].renameNx(statement);
-        }
-
+        reply = databases[databaseIndex].renameNx(arguments);
         isRecord = true;
-    } else if (command == "TYPE") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].type(statement);
-    } else if (command == "SET") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].set(statement);
-        }
-
+    } else if (command == "TYPE") reply = databases[databaseIndex].type(arguments);
+    else if (command == "OBJECT") reply = databases[databaseIndex].object(arguments);
+    else if (command == "SET") {
+        reply = databases[databaseIndex].set(arguments);
         isRecord = true;
-    } else if (command == "GET") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].get(statement);
-    } else if (command == "GETRANGE") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].getRange(statement);
-    } else if (command == "GETBIT") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].getBit(statement);
-    } else if (command == "MGET") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].mGet(statement);
-    } else if (command == "SETBIT") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].setBit(statement);
-        }
-
+    } else if (command == "GET") reply = databases[databaseIndex].get(arguments);
+    else if (command == "GETRANGE") reply = databases[databaseIndex].getRange(arguments);
+    else if (command == "GETBIT") reply = databases[databaseIndex].getBit(arguments);
+    else if (command == "MGET") reply = databases[databaseIndex].mGet(arguments);
+    else if (command == "SETBIT") {
+        reply = databases[databaseIndex].setBit(arguments);
         isRecord = true;
     } else if (command == "SETNX") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].setNx(statement);
-        }
-
+        reply = databases[databaseIndex].setNx(arguments);
         isRecord = true;
     } else if (command == "SETRANGE") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].setRange(statement);
-        }
-
+        reply = databases[databaseIndex].setRange(arguments);
         isRecord = true;
-    } else if (command == "STRLEN") {
-        const std::shared_lock lock{this->lock};
-
-        reply = this->databases[databaseIndex].strlen(statement);
-    } else if (command == "MSET") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].mSet(statement);
-        }
-
+    } else if (command == "STRLEN") reply = databases[databaseIndex].strlen(arguments);
+    else if (command == "MSET") {
+        reply = databases[databaseIndex].mSet(arguments);
         isRecord = true;
     } else if (command == "MSETNX") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].mSetNx(statement);
-        }
-
+        reply = databases[databaseIndex].mSetNx(arguments);
         isRecord = true;
     } else if (command == "INCR") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].incr(statement);
-        }
-
+        reply = databases[databaseIndex].incr(arguments);
         isRecord = true;
     } else if (command == "INCRBY") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].incrBy(statement);
-        }
-
+        reply = databases[databaseIndex].incrBy(arguments);
         isRecord = true;
     } else if (command == "DECR") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].decr(statement);
-        }
-
+        reply = databases[databaseIndex].decr(arguments);
         isRecord = true;
     } else if (command == "DECRBY") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].decrBy(statement);
-        }
-
+        reply = databases[databaseIndex].decrBy(arguments);
         isRecord = true;
     } else if (command == "APPEND") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].append(statement);
-        }
-
+        reply = databases[databaseIndex].append(arguments);
         isRecord = true;
     } else if (command == "HDEL") {
-        {
-            const std::shared_lock lock{this->lock};
-
-            reply = this->databases[databaseIndex].hDel(statement);
-        }
-
+        reply = databases[databaseIndex].hDel(arguments);
+        isRecord = true;
+    } else if (command == "HEXISTS") reply = databases[databaseIndex].hExists(arguments);
+    else if (command == "HGET") reply = databases[databaseIndex].hGet(arguments);
+    else if (command == "HGETALL") reply = databases[databaseIndex].hGetAll(arguments);
+    else if (command == "HINCRBY") {
+        reply = databases[databaseIndex].hIncrBy(arguments);
+        isRecord = true;
+    } else if (command == "HKEYS") reply = databases[databaseIndex].hKeys(arguments);
+    else if (command == "HLEN") reply = databases[databaseIndex].hLen(arguments);
+    else if (command == "HSET") {
+        reply = databases[databaseIndex].hSet(arguments);
+        isRecord = true;
+    } else if (command == "HVALS") reply = databases[databaseIndex].hVals(arguments);
+    else if (command == "LINDEX") reply = databases[databaseIndex].lIndex(arguments);
+    else if (command == "LLEN") reply = databases[databaseIndex].lLen(arguments);
+    else if (command == "LPOP") {
+        reply = databases[databaseIndex].lPop(arguments);
+        isRecord = true;
+    } else if (command == "LPUSH") {
+        reply = databases[databaseIndex].lPush(arguments);
+        isRecord = true;
+    } else if (command == "LPUSHX") {
+        reply = databases[databaseIndex].lPushX(arguments);
         isRecord = true;
-    } else if (command == "HEXISTS") {
-        const std::shared_lock lock{this->lock};
+    }
+    reply.setDatabaseIndex(context.getDatabaseIndex());
+    reply.setIsTransaction(context.getIsTransaction());
 
-        reply = this->databases[databaseIndex].hExists(statement);
-    } else if (command == "HGET") {
-        const std::shared_lock lock{this->lock};
+    if (isRecord) this->record(keyShard, databaseIndex, answer.serialize());
 
-        reply = this->databases[databaseIndex].hGet(statement);
-    } else if (command == "HGETALL") {
-        const std::shared_lock lock{this->lock};
+    return reply;
+}
 
-        reply = this->databases[databaseIndex].hGetAll(statement);
-    } else if (command == "HINCRBY") {
-        {
-            const std::shared_lock lock{this->lock};
+auto DatabaseManager::route(const Context &context, const Answer &answer) const -> long {
+    if (this->shardCount == 1) return anyShard;
+    if (!context.getIsTransaction()) return this->locate(answer);
+    if (answer.getCommand() != "EXEC") return anyShard;
 
-            reply = this->databases[databaseIndex].hIncrBy(statement);
-        }
+    long target{anyShard};
+    for (const Answer &queued : context.getAnswers()) {
+        const long shard{this->locate(queued)};
+        if (shard == manyShards) return anyShard;
+        if (shard == anyShard || shard == target) continue;
+        if (target != anyShard) return manyShards;
 
-        isRecord = true;
-    } else if (command == "HKEYS") {
-        const std::shared_lock lock{this->lock};
+        target = shard;
+    }
 
-        reply = this->databases[databaseIndex].hKeys(statement);
-    } else if (command == "HLEN") {
-        const std::shared_lock lock{this->lock};
+    return target;
+}
 
-        reply = this->databases[databaseIndex].hLen(statement);
-    } else if (command == "HSET") {
-        {
-            const std::shared_lock lock{this->lock};
+auto DatabaseManager::scatter(Context &context, const Answer &answer) const -> std::vector<Part> {
+    const std::string_view command{answer.getCommand()};
+    const std::span arguments{answer.getArguments()};
 
-            reply = this->databases[databaseIndex].hSet(statement);
+    std::vector<Part> parts;
+    if (command == "EXEC") {
+        context.setIsTransaction(false);
+        for (Answer &queued : context.getAnswers()) {
+            const long shard{this->locate(queued)};
+            parts.emplace_back(shard, std::move(queued));
         }
+        context.clearAnswers();
+    } else if (command == "FLUSHALL" || command == "FLUSHDB" || command == "DBSIZE") {
+        for (unsigned long i{}; i != this->shardCount; ++i) parts.emplace_back(static_cast<long>(i), Answer{command});
+    } else if (command == "RANDOMKEY") {
+        for (unsigned long i{}; i != this->shardCount; ++i) {
+            parts.emplace_back(static_cast<long>(i), Answer{std::string_view{"DBSIZE"}});
+            parts.emplace_back(static_cast<long>(i), Answer{command});
+        }
+    } else {
+        const unsigned long step{command == "MSET" ? 2UL : 1UL};
 
-        isRecord = true;
-    } else if (command == "HVALS") {
-        const std::shared_lock lock{this->lock};
+        std::vector<std::vector<std::string_view>> groups{this->shardCount, std::vector{command}};
+        for (unsigned long i{}; i < arguments.size(); i += step) {
+            std::vector<std::string_view> &group{groups[this->getShard(arguments[i])]};
+            group.insert(group.cend(), arguments.begin() + static_cast<long>(i),
+                         arguments.begin() + static_cast<long>(i + step));
+        }
 
-        reply = this->databases[databaseIndex].hVals(statement);
-    } else if (command == "LINDEX") {
-        const std::shared_lock lock{this->lock};
+        for (unsigned long i{}; i != this->shardCount; ++i) {
+            if (groups[i].size() != 1) parts.emplace_back(static_cast<long>(i), Answer{groups[i]});
+        }
+    }
 
-        reply = this->databases[databaseIndex].lIndex(statement);
-    } else if (command == "LLEN") {
-        const std::shared_lock lock{this->lock};
+    return parts;
+}
 
-        reply = this->databases[databaseIndex].lLen(statement);
-    } else if (command == "LPOP") {
-        {
-            const std::shared_lock lock{this->lock};
+auto DatabaseManager::gather(const Context &context, const Answer &answer, const std::span<const Part> parts,
+                             std::vector<Reply> &&replies) const -> Reply {
+    const std::string_view command{answer.getCommand()};
 
-            reply = this->databases[databaseIndex].lPop(statement);
+    Reply reply{Reply::Type::nil, 0};
+    if (command.empty()) reply = std::move(replies.front());
+    else if (command == "EXEC") reply = {Reply::Type::array, std::move(replies)};
+    else if (const auto error{std::ranges::find(replies, Reply::Type::error, &Reply::getType)};
+             error != replies.end())
+        reply = std::move(*error);
+    else if (command == "DEL" || command == "EXISTS" || command == "DBSIZE") {
+        long count{};
+        for (const Reply &part : replies) count += part.getInteger();
+
+        reply = {Reply::Type::integer, count};
+    } else if (command == "MGET") {
+        std::vector<unsigned long> cursors(parts.size());
+        std::vector<Reply> values;
+        for (const std::string_view key : answer.getArguments()) {
+            const auto index{static_cast<unsigned long>(
+                std::ranges::find(parts, static_cast<long>(this->getShard(key)), &Part::shard) - parts.begin())};
+            values.emplace_back(replies[index].getArray()[cursors[index]++]);
         }
 
-        isRecord = true;
-    } else if (command == "LPUSH") {
-        {
-            const std::shared_lock lock{this->lock};
+        reply = {Reply::Type::array, std::move(values)};
+    } else if (command == "RANDOMKEY") {
+        std::vector<unsigned long> sizes;
+        for (unsigned long i{}; i < replies.size(); i += 2) sizes.emplace_back(replies[i].getInteger());
 
-            reply = this->databases[databaseIndex].lPush(statement);
-        }
+        if (std::ranges::any_of(sizes, [](const unsigned long size) noexcept { return size != 0; }))
+            reply = std::move(replies[std::discrete_distribution<unsigned long>{sizes.cbegin(), sizes.cend()}(
+                                          getGenerator()) * 2 + 1]);
+    } else reply = {Reply::Type::status, "OK"};
 
-        isRecord = true;
-    } else if (command == "LPUSHX") {
-        {
-            const std::shared_lock lock{this->lock};
+    reply.setDatabaseIndex(context.getDatabaseIndex());
+    reply.setIsTransaction(context.getIsTransaction());
 
-            reply = this->databases[databaseIndex].lPushX(statement);
-        }
+    return reply;
+}
 
-        isRecord = true;
+auto DatabaseManager::isCostly(const std::string_view command) noexcept -> bool {
+    return command == "DEL" || command == "HGETALL" || command == "HKEYS" || command == "HVALS" ||
+           command == "FLUSHALL" || command == "FLUSHDB";
+}
+
+auto DatabaseManager::getCost(const Context &context, const Answer &answer) -> unsigned long {
+    if (context.getIsTransaction()) return 0;
+
+    const std::string_view command{answer.getCommand()};
+    if (command == "FLUSHALL" || command == "FLUSHDB") return std::numeric_limits<unsigned long>::max();
+    if (command != "DEL" && command != "HGETALL" && command != "HKEYS" && command != "HVALS") return 0;
+
+    const std::shared_lock sharedLock{this->databaseLock};
+
+    unsigned long cost{};
+    for (const std::string_view key : getKeys(command, answer.getArguments())) {
+        cost += this->databases[this->getShard(key) * databaseCount + context.getDatabaseIndex()].getSize(key);
     }
-    reply.setDatabaseIndex(context.getDatabaseIndex());
-    reply.setIsTransaction(context.getIsTransaction());
 
-    if (isRecord) this->record(answer.serialize());
+    return cost;
+}
 
-    return reply;
+auto DatabaseManager::snapshot(const unsigned long shard) -> void {
+    const unsigned long generation{this->generation.load(std::memory_order::acquire)};
+    if (this->generations[shard] == generation) return;
+
+    for (const Database &database : std::span{this->databases}.subspan(shard * databaseCount, databaseCount))
+        this->snapshots[shard].emplace_back(database.serialize());
+
+    {
+        Journal &journal{this->journals[shard]};
+        const std::lock_guard lockGuard{journal.lock};
+
+        journal.buffer.clear();
+        journal.count = 0;
+        journal.databaseIndex = databaseCount;
+    }
+
+    this->generations[shard] = generation;
+    this->snapshotCount.fetch_add(1, std::memory_order::release);
 }
 
 auto DatabaseManager::isWritable() -> bool {
     ++this->seconds;
+    if (!this->writeBuffer.empty()) return false;
+
+    if (!this->isSnapshotting &&
+        ((this->seconds >= std::chrono::seconds{900} && this->writeCount > 1) ||
+         (this->seconds >= std::chrono::seconds{300} && this->writeCount > 10) ||
+         (this->seconds >= std::chrono::seconds{60} && this->writeCount > 10000))) {
+        this->seconds = std::chrono::seconds::zero();
+        this->writeCount = 0;
+        this->isSnapshotting = true;
+        this->generation.fetch_add(1, std::memory_order::release);
+
+        if (this->shardCount == 1) {
+            const std::shared_lock sharedLock{this->databaseLock};
+            this->snapshot(0);
+        }
+    }
 
-    if (const std::lock_guard lockGuard{this->lock}; this->writeBuffer.empty()) {
-        if ((this->seconds >= std::chrono::seconds{900} && this->writeCount > 1) ||
-            (this->seconds >= std::chrono::seconds{300} && this->writeCount > 10) ||
-            (this->seconds >= std::chrono::seconds{60} && this->writeCount > 10000)) {
-            this->seconds = std::chrono::seconds::zero();
-            this->aofBuffer.clear();
-            this->writeCount = 0;
-            this->writeBuffer = this->serialize();
+    if (this->isSnapshotting) {
+        if (this->snapshotCount.load(std::memory_order::acquire) != this->shardCount) return false;
 
-            return true;
-        }
+        this->snapshotCount.store(0, std::memory_order::relaxed);
+        this->isSnapshotting = false;
+        this->isTruncating = true;
+        this->writeBuffer = this->serialize();
 
-        if (!this->aofBuffer.empty()) {
-            this->writeBuffer = std::move(this->aofBuffer);
+        return true;
+    }
+
+    for (Journal &journal : this->journals) {
+        std::vector<std::byte> buffer;
+        {
+            const std::lock_guard lockGuard{journal.lock};
 
-            return true;
+            buffer = std::exchange(journal.buffer, {});
+            this->writeCount += std::exchange(journal.count, 0);
+            journal.databaseIndex = databaseCount;
         }
+
+        this->writeBuffer.insert(this->writeBuffer.cend(), buffer.cbegin(), buffer.cend());
     }
+    this->isTruncating = false;
 
-    return false;
+    return !this->writeBuffer.empty();
 }
 
-auto DatabaseManager::isCanTruncate() const -> bool {
-    return this->seconds == std::chrono::seconds::zero() && !this->writeBuffer.empty();
-}
+auto DatabaseManager::isCanTruncate() const -> bool { return this->isTruncating && !this->writeBuffer.empty(); }
 
 auto DatabaseManager::truncate() const noexcept -> Awaiter {
     return Awaiter{
@@ -358,12 +423,15 @@ auto DatabaseManager::truncate() const noexcept -> Awaiter {
     };
 }
 
-auto DatabaseManager::write() const noexcept -> Awaiter {
+auto DatabaseManager::write(const unsigned long offset, const unsigned long size) const noexcept -> Awaiter {
     return Awaiter{
-        Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, 0, Submission::Write{this->writeBuffer, 0}}
+        Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, Submission::backgroundPriority, 0,
+                   Submission::Write{std::span{this->writeBuffer}.subspan(offset, size), 0}}
     };
 }
 
+auto DatabaseManager::getWriteSize() const noexcept -> unsigned long { return this->writeBuffer.size(); }
+
 auto DatabaseManager::wrote() noexcept -> void { this->writeBuffer.clear(); }
 
 auto DatabaseManager::serializeEmptyRdb() -> std::vector<std::byte> {
@@ -378,6 +446,63 @@ auto DatabaseManager::serializeEmptyRdb() -> std::vector<std::byte> {
     return serialization;
 }
 
+auto DatabaseManager::isArityValid(const std::string_view command, const unsigned long count) noexcept -> bool {
+    if (command == "MULTI" || command == "EXEC" || command == "DISCARD" || command == "DBSIZE" ||
+        command == "RANDOMKEY")
+        return count == 0;
+    if (command == "SELECT" || command == "TYPE" || command == "GET" || command == "STRLEN" || command == "INCR" ||
+        command == "DECR" || command == "HGETALL" || command == "HKEYS" || command == "HLEN" || command == "HVALS" ||
+        command == "LLEN" || command == "LPOP")
+        return count == 1;
+    if (command == "MOVE" || command == "RENAME" || command == "RENAMENX" || command == "SET" || command == "GETBIT" ||
+        command == "SETNX" || command == "INCRBY" || command == "DECRBY" || command == "APPEND" ||
+        command == "HEXISTS" || command == "HGET" || command == "LINDEX")
+        return count == 2;
+    if (command == "GETRANGE" || command == "SETBIT" || command == "SETRANGE" || command == "HINCRBY")
+        return count == 3;
+    if (command == "DEL" || command == "EXISTS" || command == "MGET" || command == "OBJECT" || command == "CLIENT")
+        return count >= 1;
+    if (command == "HDEL" || command == "LPUSH" || command == "LPUSHX") return count >= 2;
+    if (command == "MSET" || command == "MSETNX") return count >= 2 && count % 2 == 0;
+    if (command == "HSET") return count >= 3 && count % 2 == 1;
+
+    return true;
+}
+
+auto DatabaseManager::getKeys(const std::string_view command, const std::span<const std::string_view> arguments)
+    -> std::vector<std::string_view> {
+    if (command == "MULTI" || command == "EXEC" || command == "DISCARD" || command == "PING" || command == "HELLO" ||
+        command == "INFO" || command == "CLIENT" || command == "FLUSHALL" || command == "FLUSHDB" ||
+        command == "SELECT" || arguments.empty())
+        return {};
+
+    if (command == "DEL" || command == "EXISTS" || command == "MGET") return {arguments.begin(), arguments.end()};
+    if (command == "RENAME" || command == "RENAMENX") return {arguments.begin(), arguments.begin() + 2};
+    if (command == "OBJECT") return {arguments.begin() + 1, arguments.begin() + 2};
+
+    std::vector<std::string_view> keys;
+    if (command == "MSET" || command == "MSETNX") {
+        for (unsigned long i{}; i < arguments.size(); i += 2) keys.emplace_back(arguments[i]);
+    } else keys.emplace_back(arguments.front());
+
+    return keys;
+}
+
+auto DatabaseManager::isWrite(const std::string_view command) noexcept -> bool {
+    return command == "FLUSHALL" || command == "FLUSHDB" || command == "DEL" || command == "MOVE" ||
+           command == "RENAME" || command == "RENAMENX" || command == "SET" || command == "SETBIT" ||
+           command == "SETNX" || command == "SETRANGE" || command == "MSET" || command == "MSETNX" ||
+           command == "INCR" || command == "INCRBY" || command == "DECR" || command == "DECRBY" ||
+           command == "APPEND" || command == "HDEL" || command == "HINCRBY" || command == "HSET" ||
+           command == "LPOP" || command == "LPUSH" || command == "LPUSHX";
+}
+
+auto DatabaseManager::getGenerator() -> std::mt19937_64 & {
+    thread_local std::mt19937_64 generator{std::random_device{}()};
+
+    return generator;
+}
+
 auto DatabaseManager::multi(Context &context) -> Reply {
     context.setIsTransaction(true);
 
@@ -397,51 +522,195 @@ auto DatabaseManager::transaction(Context &context, Answer &&answer) -> Reply {
     return {Reply::Type::status, "QUEUED"};
 }
 
-auto DatabaseManager::select(Context &context, const std::string_view statement) -> Reply {
-    context.setDatabaseIndex(std::stoul(std::string{statement}));
+auto DatabaseManager::select(Context &context, const std::span<const std::string_view> arguments) -> Reply {
+    context.setDatabaseIndex(std::stoul(std::string{arguments[0]}));
 
     return {Reply::Type::status, "OK"};
 }
 
-auto DatabaseManager::record(const std::span<const std::byte> answer) -> void {
-    const std::lock_guard lockGuard{this->lock};
+auto DatabaseManager::getClientHandler() noexcept -> Handler & {
+    thread_local Handler handler;
 
-    const unsigned long size{answer.size()};
-    const auto sizeBytes{std::as_bytes(std::span{&size, 1})};
-    this->aofBuffer.insert(this->aofBuffer.cend(), sizeBytes.cbegin(), sizeBytes.cend());
+    return handler;
+}
 
-    this->aofBuffer.insert(this->aofBuffer.cend(), answer.cbegin(), answer.cend());
+auto DatabaseManager::client(const std::span<const std::string_view> arguments) -> Reply {
+    const Handler &handler{getClientHandler()};
+    if (!handler) return {Reply::Type::error, "ERR CLIENT is not available on this thread"};
 
-    ++this->writeCount;
+    return handler(arguments);
+}
+
+auto DatabaseManager::hello(Context &context, const std::span<const std::string_view> arguments) -> Reply {
+    if (const std::string_view version{arguments.empty() ? std::string_view{} : arguments[0]};
+        version == "2" || version == "3")
+        context.setProtocolVersion(version == "2" ? 2 : 3);
+    else if (!version.empty()) return {Reply::Type::error, "NOPROTO sorry, this protocol version is not supported"};
+
+    std::vector<Reply> replies;
+    replies.emplace_back(Reply::Type::string, "server");
+    replies.emplace_back(Reply::Type::string, "tinyRedis");
+    replies.emplace_back(Reply::Type::string, "proto");
+    replies.emplace_back(Reply::Type::integer, context.getProtocolVersion());
+    replies.emplace_back(Reply::Type::string, "mode");
+    replies.emplace_back(Reply::Type::string, "standalone");
+    replies.emplace_back(Reply::Type::string, "role");
+    replies.emplace_back(Reply::Type::string, "master");
+
+    return {Reply::Type::map, std::move(replies)};
+}
+
+auto DatabaseManager::ping(const std::span<const std::string_view> arguments) -> Reply {
+    if (arguments.empty()) return {Reply::Type::status, "PONG"};
+
+    return {Reply::Type::string, std::string{arguments[0]}};
+}
+
+auto DatabaseManager::record(const unsigned long shard, const unsigned long databaseIndex,
+                             const std::span<const std::byte> answer) -> void {
+    Journal &journal{this->journals[shard]};
+    const std::lock_guard lockGuard{journal.lock};
+
+    if (journal.databaseIndex != databaseIndex) {
+        const std::string index{std::to_string(databaseIndex)};
+        const std::array<std::string_view, 2> arguments{"SELECT", index};
+        const std::vector select{Answer{arguments}.serialize()};
+        journal.buffer.insert(journal.buffer.cend(), select.cbegin(), select.cend());
+
+        journal.databaseIndex = databaseIndex;
+    }
+
+    journal.buffer.insert(journal.buffer.cend(), answer.cbegin(), answer.cend());
+    ++journal.count;
+}
+
+auto DatabaseManager::getShard(const std::string_view key) const noexcept -> unsigned long {
+    return std::hash<std::string_view>{}(key) % this->shardCount;
+}
+
+auto DatabaseManager::isCrossShard(const std::span<const std::string_view> keys) const noexcept -> bool {
+    return keys.size() > 1 && std::ranges::any_of(keys.subspan(1), [this, &keys](const std::string_view key) {
+               return this->getShard(key) != this->getShard(keys.front());
+           });
+}
+
+auto DatabaseManager::locate(const Answer &answer) const -> long {
+    const std::string_view command{answer.getCommand()};
+    const std::span arguments{answer.getArguments()};
+    if (!isArityValid(command, arguments.size())) return anyShard;
+    if (command == "FLUSHALL" || command == "FLUSHDB" || command == "DBSIZE" || command == "RANDOMKEY")
+        return manyShards;
+
+    const std::vector keys{getKeys(command, arguments)};
+    if (keys.empty()) return anyShard;
+    if (!this->isCrossShard(keys)) return static_cast<long>(this->getShard(keys.front()));
+
+    return command == "DEL" || command == "EXISTS" || command == "MGET" || command == "MSET" ? manyShards : anyShard;
+}
+
+auto DatabaseManager::crossShard(const unsigned long databaseIndex, const std::string_view command,
+                                 const std::span<const std::string_view> arguments,
+                                 const std::span<const std::string_view> keys) -> Reply {
+    if (command == "DEL" || command == "EXISTS") {
+        long count{};
+        for (const std::string_view &key : keys) {
+            Database &database{this->databases[this->getShard(key) * databaseCount + databaseIndex]};
+            count += (command == "DEL" ? database.del({&key, 1}) : database.exists({&key, 1})).getInteger();
+        }
+
+        return {Reply::Type::integer, count};
+    }
+
+    if (command == "MGET") {
+        std::vector<Reply> replies;
+        for (const std::string_view &key : keys) {
+            replies.emplace_back(this->databases[this->getShard(key) * databaseCount + databaseIndex]
+                                     .mGet({&key, 1})
+                                     .getArray()
+                                     .front());
+        }
+
+        return {Reply::Type::array, std::move(replies)};
+    }
+
+    if (command == "MSET") {
+        for (unsigned long i{}; i + 1 < arguments.size(); i += 2) {
+            static_cast<void>(this->databases[this->getShard(arguments[i]) * databaseCount + databaseIndex].mSet(
+                arguments.subspan(i, 2)));
+        }
+
+        return {Reply::Type::status, "OK"};
+    }
+
+    return {Reply::Type::error, std::string{crossSlot}};
 }
 
 auto DatabaseManager::serialize() -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    for (auto &database : this->databases) {
-        const std::vector serializedDatabase{database.serialize()};
-        serialization.insert(serialization.cend(), serializedDatabase.cbegin(), serializedDatabase.cend());
+    for (unsigned long i{}; i != databaseCount; ++i) {
+        const unsigned long offset{serialization.size()};
+        serialization.resize(offset + sizeof(unsigned long));
+        for (const std::vector<std::vector<std::byte>> &snapshot : this->snapshots) {
+            serialization.insert(serialization.cend(), snapshot[i].cbegin() + sizeof(unsigned long),
+                                 snapshot[i].cend());
+        }
+
+        const unsigned long size{serialization.size() - offset - sizeof(size)};
+        std::memcpy(serialization.data() + offset, &size, sizeof(size));
     }
 
+    for (std::vector<std::vector<std::byte>> &snapshot : this->snapshots) snapshot.clear();
+
     return serialization;
 }
 
 auto DatabaseManager::exec(Context &context) -> Reply {
-    std::vector<Reply> replies;
-
     context.setIsTransaction(false);
+    if (this->shardCount != 1 && std::ranges::any_of(context.getAnswers(), [this](const Answer &answer) {
+            return this->locate(answer) == manyShards;
+        })) {
+        context.clearAnswers();
+
+        return {Reply::Type::error, std::string{crossSlot}};
+    }
+
+    std::vector<Reply> replies;
     for (Answer &answer : context.getAnswers()) replies.emplace_back(Reply{this->query(context, std::move(answer))});
     context.clearAnswers();
 
     return {Reply::Type::array, std::move(replies)};
 }
 
-auto DatabaseManager::flushAll() -> Reply {
-    {
-        const std::lock_guard lockGuard{this->lock};
+auto DatabaseManager::flushAll(const unsigned long first, const unsigned long last) -> Reply {
+    for (auto &database : std::span{this->databases}.subspan(first * databaseCount, (last - first) * databaseCount))
+        database.flushDb();
+
+    return {Reply::Type::status, "OK"};
+}
 
-        for (auto &database : this->databases) database.flushDb();
+auto DatabaseManager::dbSize(const unsigned long databaseIndex, const unsigned long first,
+                             const unsigned long last) const -> Reply {
+    unsigned long size{};
+    for (unsigned long i{first}; i != last; ++i)
+        size += this->databases[i * databaseCount + databaseIndex].getKeyCount();
+
+    return {Reply::Type::integer, static_cast<long>(size)};
+}
+
+auto DatabaseManager::randomKey(const unsigned long databaseIndex, const unsigned long first,
+                                const unsigned long last) const -> Reply {
+    unsigned long shard{first};
+    if (last - first != 1) {
+        std::vector<unsigned long> sizes;
+        for (unsigned long i{first}; i != last; ++i)
+            sizes.emplace_back(this->databases[i * databaseCount + databaseIndex].getKeyCount());
+
+        if (std::ranges::all_of(sizes, [](const unsigned long size) noexcept { return size == 0; }))
+            return {Reply::Type::nil, 0};
+
+        shard += std::discrete_distribution<unsigned long>{sizes.cbegin(), sizes.cend()}(getGenerator());
     }
 
-    return {Reply::Type::status, "OK"};
+    return this->databases[shard * databaseCount + databaseIndex].randomKey(getGenerator()());
 }
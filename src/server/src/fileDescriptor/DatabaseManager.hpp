@@ -1,18 +1,35 @@
 #pragma once
 
+#include "../../../common/Answer.hpp"
 #include "../database/Database.hpp"
 #include "FileDescriptor.hpp"
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
 #include <source_location>
 
-class Answer;
 class Context;
 
 class DatabaseManager final : public FileDescriptor {
 public:
     [[nodiscard]] static auto create(std::source_location sourceLocation = std::source_location::current()) -> int;
 
-    explicit DatabaseManager(int fileDescriptor);
+    using Handler = std::function<Reply(std::span<const std::string_view>)>;
+
+    static constexpr long anyShard{-1}, manyShards{-2};
+
+    struct Part {
+        long shard;
+        Answer answer;
+    };
+
+    static auto setClientHandler(Handler &&handler) noexcept -> void;
+
+    DatabaseManager(int fileDescriptor, unsigned long shardCount, unsigned long listPackMaxEntries,
+                    unsigned long listPackMaxValue);
 
     DatabaseManager(const DatabaseManager &) = delete;
 
@@ -24,7 +41,20 @@ public:
 
     ~DatabaseManager() override = default;
 
-    auto query(Context &context, Answer &&answer) -> Reply;
+    auto query(Context &context, Answer &&answer, long shard = anyShard) -> Reply;
+
+    [[nodiscard]] auto route(const Context &context, const Answer &answer) const -> long;
+
+    [[nodiscard]] auto scatter(Context &context, const Answer &answer) const -> std::vector<Part>;
+
+    [[nodiscard]] auto gather(const Context &context, const Answer &answer, std::span<const Part> parts,
+                              std::vector<Reply> &&replies) const -> Reply;
+
+    [[nodiscard]] static auto isCostly(std::string_view command) noexcept -> bool;
+
+    [[nodiscard]] auto getCost(const Context &context, const Answer &answer) -> unsigned long;
+
+    auto snapshot(unsigned long shard) -> void;
 
     [[nodiscard]] auto isWritable() -> bool;
 
@@ -32,35 +62,82 @@ public:
 
     [[nodiscard]] auto truncate() const noexcept -> Awaiter;
 
-    [[nodiscard]] auto write() const noexcept -> Awaiter;
+    [[nodiscard]] auto write(unsigned long offset, unsigned long size) const noexcept -> Awaiter;
+
+    [[nodiscard]] auto getWriteSize() const noexcept -> unsigned long;
 
     auto wrote() noexcept -> void;
 
 private:
+    static constexpr unsigned long databaseCount{16};
+
+    struct Journal {
+        std::mutex lock;
+        std::vector<std::byte> buffer;
+        unsigned long count{}, databaseIndex{databaseCount};
+    };
+
     [[nodiscard]] static auto serializeEmptyRdb() -> std::vector<std::byte>;
 
+    [[nodiscard]] static auto isArityValid(std::string_view command, unsigned long count) noexcept -> bool;
+
+    [[nodiscard]] static auto getKeys(std::string_view command, std::span<const std::string_view> arguments)
+        -> std::vector<std::string_view>;
+
+    [[nodiscard]] static auto isWrite(std::string_view command) noexcept -> bool;
+
+    [[nodiscard]] static auto getGenerator() -> std::mt19937_64 &;
+
     [[nodiscard]] static auto multi(Context &context) -> Reply;
 
     [[nodiscard]] static auto discard(Context &context) -> Reply;
 
     [[nodiscard]] static auto transaction(Context &context, Answer &&answer) -> Reply;
 
-    [[nodiscard]] static auto select(Context &context, std::string_view statement) -> Reply;
+    [[nodiscard]] static auto select(Context &context, std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] static auto hello(Context &context, std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] static auto getClientHandler() noexcept -> Handler &;
+
+    [[nodiscard]] static auto client(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] static auto ping(std::span<const std::string_view> arguments) -> Reply;
 
-    auto record(std::span<const std::byte> answer) -> void;
+    auto record(unsigned long shard, unsigned long databaseIndex, std::span<const std::byte> answer) -> void;
+
+    [[nodiscard]] auto getShard(std::string_view key) const noexcept -> unsigned long;
+
+    [[nodiscard]] auto isCrossShard(std::span<const std::string_view> keys) const noexcept -> bool;
+
+    [[nodiscard]] auto locate(const Answer &answer) const -> long;
+
+    [[nodiscard]] auto crossShard(unsigned long databaseIndex, std::string_view command,
+                                  std::span<const std::string_view> arguments, std::span<const std::string_view> keys)
+        -> Reply;
 
     [[nodiscard]] auto serialize() -> std::vector<std::byte>;
 
     [[nodiscard]] auto exec(Context &context) -> Reply;
 
-    [[nodiscard]] auto flushAll() -> Reply;
+    [[nodiscard]] auto flushAll(unsigned long first, unsigned long last) -> Reply;
+
+    [[nodiscard]] auto dbSize(unsigned long databaseIndex, unsigned long first, unsigned long last) const -> Reply;
+
+    [[nodiscard]] auto randomKey(unsigned long databaseIndex, unsigned long first, unsigned long last) const
+        -> Reply;
 
-    static constexpr unsigned long databaseCount{16};
     static constexpr std::string filepath{"dump.aof"};
+    static constexpr std::string_view crossSlot{"CROSSSLOT Keys in request don't hash to the same shard"};
 
     std::vector<Database> databases;
-    std::shared_mutex lock;
-    std::vector<std::byte> aofBuffer, writeBuffer;
+    std::shared_mutex databaseLock;
+    std::vector<Journal> journals;
+    std::vector<std::vector<std::vector<std::byte>>> snapshots;
+    std::vector<unsigned long> generations;
+    std::vector<std::byte> writeBuffer;
     std::chrono::seconds seconds{};
-    unsigned long writeCount{};
+    std::atomic<unsigned long> generation{}, snapshotCount{};
+    unsigned long shardCount, writeCount{};
+    bool isSnapshotting{}, isTruncating{};
 };
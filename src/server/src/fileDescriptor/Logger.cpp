@@ -30,7 +30,8 @@ auto Logger::write() -> Awaiter {
     this->logs.clear();
 
     return Awaiter{
-        Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, 0, Submission::Write{this->buffer, 0}}
+        Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, Submission::backgroundPriority, 0,
+                   Submission::Write{this->buffer, 0}}
     };
 }
 
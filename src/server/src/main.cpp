@@ -4,12 +4,12 @@ auto main() -> int {
     Scheduler::registerSignal();
 
     std::atomic_uint cpuCode;
-    Scheduler scheduler{-1, cpuCode, true};
+    Scheduler scheduler{-1, cpuCode};
 
     std::vector<std::jthread> workers{std::jthread::hardware_concurrency() - 1};
     for (const int sharedFileDescriptor{scheduler.getRingFileDescriptor()}; auto &worker : workers) {
         worker = std::jthread{[sharedFileDescriptor, &cpuCode] {
-            Scheduler otherScheduler{sharedFileDescriptor, cpuCode++, false};
+            Scheduler otherScheduler{sharedFileDescriptor, ++cpuCode};
             otherScheduler.run();
         }};
     }
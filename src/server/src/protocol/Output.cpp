@@ -0,0 +1,16 @@
+#include "Output.hpp"
+
+#include <algorithm>
+
+Output::Output(const std::span<std::byte> buffer, std::vector<std::byte> &overflow) noexcept :
+    buffer{buffer}, overflow{overflow} {}
+
+auto Output::write(const std::span<const std::byte> data) -> void {
+    const unsigned long count{this->overflow.empty() ? std::min(data.size(), this->buffer.size() - this->size) : 0};
+    std::ranges::copy(data.first(count), this->buffer.begin() + static_cast<long>(this->size));
+    this->size += count;
+
+    this->overflow.insert(this->overflow.cend(), data.cbegin() + static_cast<long>(count), data.cend());
+}
+
+auto Output::getSize() const noexcept -> unsigned long { return this->size; }
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+class Output {
+public:
+    Output(std::span<std::byte> buffer, std::vector<std::byte> &overflow) noexcept;
+
+    auto write(std::span<const std::byte> data) -> void;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
+
+private:
+    std::span<std::byte> buffer;
+    std::vector<std::byte> &overflow;
+    unsigned long size{};
+};
@@ -0,0 +1,215 @@
+#include "Parser.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+auto Parser::append(const std::span<const std::byte> data) -> void {
+    if (this->isInvalid) return;
+
+    if (this->buffer.empty() && this->input.empty()) this->input = data;
+    else {
+        if (!this->input.empty()) this->compact();
+
+        this->buffer.insert(this->buffer.cend(), data.cbegin(), data.cend());
+    }
+}
+
+auto Parser::parse() -> std::optional<Answer> {
+    while (!this->isInvalid) {
+        const std::span data{(this->input.empty() ? std::span<const std::byte>{this->buffer} : this->input)
+                                 .subspan(this->offset)};
+
+        if (this->protocol == Protocol::unknown) this->protocol = detect(data);
+
+        std::optional<Answer> answer;
+        switch (this->protocol) {
+            case Protocol::unknown:
+                break;
+            case Protocol::native:
+                answer = this->parseNative(data);
+                break;
+            case Protocol::resp:
+                answer = this->parseResp(data);
+                break;
+        }
+
+        if (answer) {
+            if (!answer->getCommand().empty()) return answer;
+
+            continue;
+        }
+
+        break;
+    }
+
+    this->compact();
+
+    return std::nullopt;
+}
+
+auto Parser::getProtocol() const noexcept -> Protocol { return this->protocol; }
+
+auto Parser::getSize() const noexcept -> unsigned long {
+    return (this->input.empty() ? this->buffer.size() : this->input.size()) - this->offset;
+}
+
+auto Parser::takeError() noexcept -> std::string_view { return std::exchange(this->error, {}); }
+
+auto Parser::getIsInvalid() const noexcept -> bool { return this->isInvalid; }
+
+auto Parser::detect(const std::span<const std::byte> data) noexcept -> Protocol {
+    if (data.empty()) return Protocol::unknown;
+
+    const std::span header{data.first(std::min(data.size(), sizeof(unsigned long)))};
+    if (std::ranges::find(header, std::byte{}) != header.end() || data.front() < std::byte{'!'} ||
+        data.front() > std::byte{'~'})
+        return Protocol::native;
+
+    if (header.size() == sizeof(unsigned long) || std::ranges::find(header, std::byte{'\n'}) != header.end())
+        return Protocol::resp;
+
+    return Protocol::unknown;
+}
+
+auto Parser::findLine(const std::span<const std::byte> data) noexcept -> std::optional<std::string_view> {
+    const std::string_view text{reinterpret_cast<const char *>(data.data()), data.size()};
+
+    if (const unsigned long position{text.find('\n')}; position != std::string_view::npos)
+        return text.substr(0, position + 1);
+
+    return std::nullopt;
+}
+
+auto Parser::parseNumber(std::string_view line) noexcept -> std::optional<long> {
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) line.remove_suffix(1);
+
+    long number;
+    if (const auto [end, error]{std::from_chars(line.data(), line.data() + line.size(), number)};
+        error == std::errc{} && end == line.data() + line.size())
+        return number;
+
+    return std::nullopt;
+}
+
+auto Parser::parseNative(const std::span<const std::byte> data) -> std::optional<Answer> {
+    if (data.size() >= sizeof(unsigned long)) {
+        unsigned long size;
+        std::memcpy(&size, data.data(), sizeof(size));
+
+        if (data.size() - sizeof(size) >= size) {
+            this->offset += sizeof(size) + size;
+
+            return Answer{data.subspan(sizeof(size), size)};
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto Parser::parseResp(const std::span<const std::byte> data) -> std::optional<Answer> {
+    if (data.empty()) return std::nullopt;
+
+    return data.front() == std::byte{'*'} ? this->parseMultiBulk(data) : this->parseInline(data);
+}
+
+auto Parser::parseInline(const std::span<const std::byte> data) -> std::optional<Answer> {
+    const std::optional line{findLine(data.subspan(this->cursor))};
+    if (!line) {
+        this->cursor = data.size();
+
+        return std::nullopt;
+    }
+
+    std::string_view statement{reinterpret_cast<const char *>(data.data()), this->cursor + line->size()};
+    this->offset += statement.size();
+    this->cursor = 0;
+
+    while (!statement.empty() && (statement.back() == '\n' || statement.back() == '\r')) statement.remove_suffix(1);
+
+    return Answer{statement};
+}
+
+auto Parser::parseMultiBulk(const std::span<const std::byte> data) -> std::optional<Answer> {
+    if (this->cursor == 0) {
+        const std::optional line{findLine(data)};
+        if (!line) return std::nullopt;
+
+        const std::optional count{parseNumber(line->substr(1))};
+        if (!count) {
+            this->invalidate("ERR Protocol error: invalid multibulk length");
+
+            return std::nullopt;
+        }
+
+        this->argumentCount = *count > 0 ? static_cast<unsigned long>(*count) : 0;
+        this->cursor = line->size();
+    }
+
+    while (this->arguments.size() != this->argumentCount) {
+        const std::span rest{data.subspan(this->cursor)};
+
+        const std::optional line{findLine(rest)};
+        if (!line) return std::nullopt;
+
+        if (line->front() != '$') {
+            this->invalidate("ERR Protocol error: expected '$'");
+
+            return std::nullopt;
+        }
+
+        const std::optional size{parseNumber(line->substr(1))};
+        if (!size || *size < 0) {
+            this->invalidate("ERR Protocol error: invalid bulk length");
+
+            return std::nullopt;
+        }
+
+        const auto argumentSize{static_cast<unsigned long>(*size)};
+        if (rest.size() < line->size() + argumentSize + 2) return std::nullopt;
+
+        if (const std::string_view terminator{
+                reinterpret_cast<const char *>(rest.data()) + line->size() + argumentSize, 2};
+            terminator != "\r\n") {
+            this->invalidate("ERR Protocol error: invalid bulk terminator");
+
+            return std::nullopt;
+        }
+
+        this->arguments.emplace_back(this->cursor + line->size(), argumentSize);
+        this->cursor += line->size() + argumentSize + 2;
+    }
+
+    std::vector<std::string_view> arguments;
+    arguments.reserve(this->arguments.size());
+    for (const auto &[position, size] : this->arguments)
+        arguments.emplace_back(reinterpret_cast<const char *>(data.data()) + position, size);
+
+    this->offset += this->cursor;
+    this->cursor = 0;
+    this->arguments.clear();
+
+    return Answer{arguments};
+}
+
+auto Parser::invalidate(const std::string_view error) noexcept -> void {
+    this->error = error;
+    this->isInvalid = true;
+
+    this->buffer = {};
+    this->input = {};
+    this->arguments = {};
+    this->offset = 0;
+    this->cursor = 0;
+}
+
+auto Parser::compact() -> void {
+    if (!this->input.empty()) {
+        this->buffer.assign(this->input.begin() + static_cast<long>(this->offset), this->input.end());
+        this->input = {};
+    } else if (this->offset == this->buffer.size()) this->buffer.clear();
+    else this->buffer.erase(this->buffer.cbegin(), this->buffer.cbegin() + static_cast<long>(this->offset));
+
+    this->offset = 0;
+}
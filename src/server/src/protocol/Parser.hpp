@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../../../common/Answer.hpp"
+
+#include <optional>
+
+class Parser {
+public:
+    enum class Protocol : unsigned char { unknown, native, resp };
+
+    constexpr Parser() noexcept = default;
+
+    auto append(std::span<const std::byte> data) -> void;
+
+    [[nodiscard]] auto parse() -> std::optional<Answer>;
+
+    [[nodiscard]] auto getProtocol() const noexcept -> Protocol;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto takeError() noexcept -> std::string_view;
+
+    [[nodiscard]] auto getIsInvalid() const noexcept -> bool;
+
+    auto compact() -> void;
+
+private:
+    [[nodiscard]] static auto detect(std::span<const std::byte> data) noexcept -> Protocol;
+
+    [[nodiscard]] static auto findLine(std::span<const std::byte> data) noexcept -> std::optional<std::string_view>;
+
+    [[nodiscard]] static auto parseNumber(std::string_view line) noexcept -> std::optional<long>;
+
+    [[nodiscard]] auto parseNative(std::span<const std::byte> data) -> std::optional<Answer>;
+
+    [[nodiscard]] auto parseResp(std::span<const std::byte> data) -> std::optional<Answer>;
+
+    [[nodiscard]] auto parseInline(std::span<const std::byte> data) -> std::optional<Answer>;
+
+    [[nodiscard]] auto parseMultiBulk(std::span<const std::byte> data) -> std::optional<Answer>;
+
+    auto invalidate(std::string_view error) noexcept -> void;
+
+    std::vector<std::byte> buffer;
+    std::span<const std::byte> input;
+    std::vector<std::pair<unsigned long, unsigned long>> arguments;
+    std::string_view error;
+    unsigned long offset{}, cursor{}, argumentCount{};
+    Protocol protocol{Protocol::unknown};
+    bool isInvalid{};
+};
@@ -0,0 +1,57 @@
+#include "Resp.hpp"
+
+#include "../../../common/Reply.hpp"
+#include "Output.hpp"
+
+#include <array>
+#include <charconv>
+
+auto Resp::serialize(const Reply &reply, const unsigned char version, Output &output) -> void {
+    switch (reply.getType()) {
+        case Reply::Type::nil:
+            serializeText(version == 3 ? "_\r\n" : "$-1\r\n", output);
+            break;
+        case Reply::Type::integer:
+            serializeHeader(':', reply.getInteger(), output);
+            break;
+        case Reply::Type::error:
+            serializeText("-", output);
+            serializeText(reply.getString(), output);
+            serializeText("\r\n", output);
+            break;
+        case Reply::Type::status:
+            serializeText("+", output);
+            serializeText(reply.getString(), output);
+            serializeText("\r\n", output);
+            break;
+        case Reply::Type::string:
+            serializeHeader('$', static_cast<long>(reply.getString().size()), output);
+            serializeText(reply.getString(), output);
+            serializeText("\r\n", output);
+            break;
+        case Reply::Type::array:
+            serializeHeader('*', static_cast<long>(reply.getArray().size()), output);
+            for (const Reply &element : reply.getArray()) serialize(element, version, output);
+            break;
+        case Reply::Type::map:
+            if (version == 3) serializeHeader('%', static_cast<long>(reply.getArray().size() / 2), output);
+            else serializeHeader('*', static_cast<long>(reply.getArray().size()), output);
+            for (const Reply &element : reply.getArray()) serialize(element, version, output);
+            break;
+    }
+}
+
+auto Resp::serializeHeader(const char prefix, const long number, Output &output) -> void {
+    std::array<char, 24> header;
+    header.front() = prefix;
+
+    char *const end{std::to_chars(header.data() + 1, header.data() + header.size() - 2, number).ptr};
+    end[0] = '\r';
+    end[1] = '\n';
+
+    serializeText(std::string_view{header.data(), end + 2}, output);
+}
+
+auto Resp::serializeText(const std::string_view text, Output &output) -> void {
+    output.write(std::as_bytes(std::span{text}));
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string_view>
+
+class Output;
+class Reply;
+
+class Resp {
+public:
+    static auto serialize(const Reply &reply, unsigned char version, Output &output) -> void;
+
+private:
+    static auto serializeHeader(char prefix, long number, Output &output) -> void;
+
+    static auto serializeText(std::string_view text, Output &output) -> void;
+};
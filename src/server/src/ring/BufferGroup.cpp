@@ -1,9 +1,14 @@
 #include "BufferGroup.hpp"
 
-BufferGroup::BufferGroup(const unsigned int count) : size{static_cast<long>(this->group.size()) / count} {}
+BufferGroup::BufferGroup(const unsigned int count, const unsigned long size) :
+    group(count * size), size{static_cast<long>(size)} {}
 
 auto BufferGroup::getBuffer(const unsigned short index) noexcept -> std::span<std::byte> {
     const auto offset{this->group.begin() + index * this->size};
 
     return {offset, offset + this->size};
 }
+
+auto BufferGroup::getCount() const noexcept -> unsigned int { return this->group.size() / this->size; }
+
+auto BufferGroup::getSize() const noexcept -> unsigned long { return this->size; }
@@ -1,15 +1,19 @@
 #pragma once
 
-#include <thread>
+#include <span>
 #include <vector>
 
 class BufferGroup {
 public:
-    explicit BufferGroup(unsigned int count);
+    BufferGroup(unsigned int count, unsigned long size);
 
     [[nodiscard]] auto getBuffer(unsigned short index) noexcept -> std::span<std::byte>;
 
+    [[nodiscard]] auto getCount() const noexcept -> unsigned int;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
+
 private:
-    std::vector<std::byte> group{std::bit_ceil(2 * 1024 * 1024 / std::thread::hardware_concurrency())};
+    std::vector<std::byte> group;
     long size;
 };
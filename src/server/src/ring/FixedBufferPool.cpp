@@ -0,0 +1,31 @@
+#include "FixedBufferPool.hpp"
+
+FixedBufferPool::FixedBufferPool(const unsigned int count, const unsigned long size) :
+    pool(count * size), size{size} {
+    this->freeIndexes.reserve(count);
+    for (int i{static_cast<int>(count) - 1}; i >= 0; --i) this->freeIndexes.emplace_back(i);
+}
+
+auto FixedBufferPool::getIovecs() noexcept -> std::vector<iovec> {
+    std::vector<iovec> iovecs;
+    iovecs.reserve(this->freeIndexes.capacity());
+    for (unsigned long offset{}; offset != this->pool.size(); offset += this->size)
+        iovecs.emplace_back(iovec{this->pool.data() + offset, this->size});
+
+    return iovecs;
+}
+
+auto FixedBufferPool::acquire() noexcept -> int {
+    if (this->freeIndexes.empty()) return -1;
+
+    const int index{this->freeIndexes.back()};
+    this->freeIndexes.pop_back();
+
+    return index;
+}
+
+auto FixedBufferPool::release(const int index) -> void { this->freeIndexes.emplace_back(index); }
+
+auto FixedBufferPool::getBuffer(const int index) noexcept -> std::span<std::byte> {
+    return {this->pool.data() + index * this->size, this->size};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <span>
+#include <sys/uio.h>
+#include <vector>
+
+class FixedBufferPool {
+public:
+    FixedBufferPool(unsigned int count, unsigned long size);
+
+    [[nodiscard]] auto getIovecs() noexcept -> std::vector<iovec>;
+
+    [[nodiscard]] auto acquire() noexcept -> int;
+
+    auto release(int index) -> void;
+
+    [[nodiscard]] auto getBuffer(int index) noexcept -> std::span<std::byte>;
+
+private:
+    std::vector<std::byte> pool;
+    std::vector<int> freeIndexes;
+    unsigned long size;
+};
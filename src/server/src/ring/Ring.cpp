@@ -1,8 +1,9 @@
 #include "Ring.hpp"
 
 #include "../../../common/Exception.hpp"
-#include "Completion.hpp"
-#include "Submission.hpp"
+#include "../statistics/Statistics.hpp"
+
+#include <atomic>
 
 Ring::Ring(const unsigned int entries, io_uring_params &params) :
     handle{[entries, &params](const std::source_location sourceLocation = std::source_location::current()) {
@@ -17,7 +18,10 @@ Ring::Ring(const unsigned int entries, io_uring_params &params) :
         return handle;
     }()} {}
 
-Ring::Ring(Ring &&other) noexcept : handle{other.handle} { other.handle.ring_fd = -1; }
+Ring::Ring(Ring &&other) noexcept :
+    handle{other.handle}, overflowSubmissions{std::move(other.overflowSubmissions)} {
+    other.handle.ring_fd = -1;
+}
 
 auto Ring::operator=(Ring &&other) noexcept -> Ring & {
     if (this == &other) return *this;
@@ -26,6 +30,7 @@ auto Ring::operator=(Ring &&other) noexcept -> Ring & {
 
     this->handle = other.handle;
     other.handle.ring_fd = -1;
+    this->overflowSubmissions = std::move(other.overflowSubmissions);
 
     return *this;
 }
@@ -34,6 +39,8 @@ Ring::~Ring() { this->destroy(); }
 
 auto Ring::getFileDescriptor() const noexcept -> int { return this->handle.ring_fd; }
 
+auto Ring::getFeatures() const noexcept -> unsigned int { return this->handle.features; }
+
 auto Ring::registerSelfFileDescriptor(const std::source_location sourceLocation) -> void {
     if (const int result{io_uring_register_ring_fd(&this->handle)}; result != 1) {
         throw Exception{
@@ -86,10 +93,22 @@ auto Ring::updateFileDescriptors(const unsigned int offset, const std::span<cons
     }
 }
 
+auto Ring::registerBuffers(const std::span<const iovec> buffers, const std::source_location sourceLocation) -> void {
+    if (const int result{io_uring_register_buffers(&this->handle, buffers.data(), buffers.size())}; result != 0) {
+        throw Exception{
+            Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                sourceLocation}
+        };
+    }
+}
+
 auto Ring::setupRingBuffer(const unsigned int entries, const int id, const std::source_location sourceLocation)
     -> io_uring_buf_ring * {
     int result;
-    io_uring_buf_ring *const ringBufferHandle{io_uring_setup_buf_ring(&this->handle, entries, id, 0, &result)};
+    io_uring_buf_ring *ringBufferHandle{
+        io_uring_setup_buf_ring(&this->handle, entries, id, IOU_PBUF_RING_INC, &result)};
+    if (ringBufferHandle == nullptr && result == -EINVAL)
+        ringBufferHandle = io_uring_setup_buf_ring(&this->handle, entries, id, 0, &result);
     if (ringBufferHandle == nullptr) {
         throw Exception{
             Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
@@ -111,6 +130,95 @@ auto Ring::freeRingBuffer(io_uring_buf_ring *const ringBufferHandle, const unsig
 }
 
 auto Ring::submit(const Submission &submission) -> void {
+    if (!this->overflowSubmissions.empty() || !this->reserve(getSqeCount(submission))) {
+        this->overflowSubmissions.emplace_back(submission);
+
+        Statistics &statistics{Statistics::get()};
+        statistics.add(Statistics::Counter::submissionOverflow);
+        statistics.raise(Statistics::Counter::submissionOverflowPeak, this->overflowSubmissions.size());
+
+        return;
+    }
+
+    this->prepare(submission);
+}
+
+auto Ring::message(const int ringFileDescriptor, const unsigned long data, const unsigned long userData) -> void {
+    this->submit(Submission{ringFileDescriptor, IOSQE_CQE_SKIP_SUCCESS, 0, userData, Submission::Message{data}});
+}
+
+auto Ring::wait(const unsigned int count, const std::source_location sourceLocation) -> void {
+    this->drain();
+
+    if (const int result{io_uring_submit_and_wait(&this->handle, count)}; result < 0) {
+        throw Exception{
+            Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                sourceLocation}
+        };
+    }
+}
+
+auto Ring::wait(const unsigned int count, const std::chrono::microseconds minimumWait,
+                const std::source_location sourceLocation) -> void {
+    this->drain();
+
+    io_uring_cqe *cqe;
+    if (const int result{io_uring_submit_and_wait_min_timeout(&this->handle, &cqe, count, nullptr,
+                                                              static_cast<unsigned int>(minimumWait.count()), nullptr)};
+        result < 0) {
+        throw Exception{
+            Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                sourceLocation}
+        };
+    }
+}
+
+auto Ring::spin(const std::chrono::microseconds duration, const std::source_location sourceLocation) -> bool {
+    this->drain();
+
+    if (const int result{io_uring_submit(&this->handle)}; result < 0) {
+        throw Exception{
+            Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
+                sourceLocation}
+        };
+    }
+
+    const auto deadline{std::chrono::steady_clock::now() + duration};
+    do {
+        if (io_uring_cq_ready(&this->handle) != 0) return true;
+
+        if ((std::atomic_ref{*this->handle.sq.kflags}.load(std::memory_order::acquire) &
+             (IORING_SQ_TASKRUN | IORING_SQ_CQ_OVERFLOW)) != 0)
+            io_uring_get_events(&this->handle);
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    return io_uring_cq_ready(&this->handle) != 0;
+}
+
+auto Ring::advance(const int completionCount) noexcept -> void {
+    io_uring_cq_advance(&this->handle, completionCount);
+
+    Statistics &statistics{Statistics::get()};
+    if (io_uring_cq_has_overflow(&this->handle)) statistics.add(Statistics::Counter::completionOverflow);
+    statistics.set(Statistics::Counter::completionDrop, *this->handle.cq.koverflow);
+}
+
+auto Ring::getSqeCount(const Submission &submission) noexcept -> unsigned int {
+    switch (static_cast<Submission::Type>(submission.parameter.index())) {
+        case Submission::Type::send:
+            return std::get<Submission::Send>(submission.parameter).timeout != nullptr ? 2 : 1;
+        case Submission::Type::sendZeroCopy:
+            return std::get<Submission::SendZeroCopy>(submission.parameter).timeout != nullptr ? 2 : 1;
+        default:
+            return 1;
+    }
+}
+
+auto Ring::destroy() noexcept -> void {
+    if (this->handle.ring_fd != -1) io_uring_queue_exit(&this->handle);
+}
+
+auto Ring::prepare(const Submission &submission) -> void {
     io_uring_sqe *const sqe{this->getSqe()};
 
     switch (static_cast<Submission::Type>(submission.parameter.index())) {
@@ -145,9 +253,23 @@ auto Ring::submit(const Submission &submission) -> void {
             }
         [[likely]] case Submission::Type::send:
             {
-                const auto [buffer, flags, zeroCopyFlags]{std::get<Submission::Send>(submission.parameter)};
-                io_uring_prep_send_zc(sqe, submission.fileDescriptor, buffer.data(), buffer.size(), flags,
-                                      zeroCopyFlags);
+                const auto [buffer, flags, timeout]{std::get<Submission::Send>(submission.parameter)};
+                io_uring_prep_send(sqe, submission.fileDescriptor, buffer.data(), buffer.size(), flags);
+                this->linkTimeout(sqe, timeout);
+
+                break;
+            }
+        case Submission::Type::sendZeroCopy:
+            {
+                const auto [buffer, flags, zeroCopyFlags, bufferIndex, timeout]{
+                    std::get<Submission::SendZeroCopy>(submission.parameter)};
+                if ((zeroCopyFlags & IORING_RECVSEND_FIXED_BUF) != 0) {
+                    io_uring_prep_send_zc_fixed(sqe, submission.fileDescriptor, buffer.data(), buffer.size(), flags,
+                                                zeroCopyFlags, bufferIndex);
+                } else
+                    io_uring_prep_send_zc(sqe, submission.fileDescriptor, buffer.data(), buffer.size(), flags,
+                                          zeroCopyFlags);
+                this->linkTimeout(sqe, timeout);
 
                 break;
             }
@@ -160,45 +282,67 @@ auto Ring::submit(const Submission &submission) -> void {
             io_uring_prep_close_direct(sqe, submission.fileDescriptor);
 
             break;
+        case Submission::Type::cancel:
+            {
+                const auto [userData, flags]{std::get<Submission::Cancel>(submission.parameter)};
+                if ((flags & IORING_ASYNC_CANCEL_FD) != 0)
+                    io_uring_prep_cancel_fd(sqe, submission.fileDescriptor, flags & ~IORING_ASYNC_CANCEL_FD);
+                else io_uring_prep_cancel64(sqe, userData, flags);
+
+                break;
+            }
+        case Submission::Type::message:
+            io_uring_prep_msg_ring(sqe, submission.fileDescriptor, 0,
+                                   std::get<Submission::Message>(submission.parameter).data, 0);
+
+            break;
+        case Submission::Type::messageFileDescriptor:
+            {
+                const auto [sourceFileDescriptor, data]{
+                    std::get<Submission::MessageFileDescriptor>(submission.parameter)};
+                io_uring_prep_msg_ring_fd_alloc(sqe, submission.fileDescriptor, sourceFileDescriptor, data, 0);
+
+                break;
+            }
     }
 
-    io_uring_sqe_set_flags(sqe, submission.flags);
+    sqe->flags |= submission.flags;
     sqe->ioprio |= submission.ioPriority;
     io_uring_sqe_set_data64(sqe, submission.userData);
 }
 
-auto Ring::wait(const unsigned int count, const std::source_location sourceLocation) -> void {
-    if (const int result{io_uring_submit_and_wait(&this->handle, count)}; result < 0) {
+auto Ring::reserve(const unsigned int count) -> bool {
+    if (io_uring_sq_space_left(&this->handle) < count) this->flush();
+
+    return io_uring_sq_space_left(&this->handle) >= count;
+}
+
+auto Ring::flush(const std::source_location sourceLocation) -> void {
+    if (const int result{io_uring_submit(&this->handle)}; result < 0 && result != -EBUSY && result != -EAGAIN) {
         throw Exception{
             Log{Log::Level::error, std::error_code{std::abs(result), std::generic_category()}.message(),
                 sourceLocation}
         };
     }
-}
 
-auto Ring::poll(std::move_only_function<auto(const Completion &completion)->void> &&action) const -> int {
-    int count{};
+    Statistics::get().add(Statistics::Counter::submissionFlush);
+}
 
-    unsigned int head;
-    const io_uring_cqe *cqe;
-    io_uring_for_each_cqe(&this->handle, head, cqe) {
-        action(Completion{
-            Outcome{cqe->res, cqe->flags},
-            io_uring_cqe_get_data64(cqe)
-        });
-        ++count;
+auto Ring::drain() -> void {
+    while (!this->overflowSubmissions.empty() && this->reserve(getSqeCount(this->overflowSubmissions.front()))) {
+        this->prepare(this->overflowSubmissions.front());
+        this->overflowSubmissions.pop_front();
     }
-
-    return count;
 }
 
-auto Ring::advance(io_uring_buf_ring *const ringBuffer, const int completionCount, const int ringBufferCount) noexcept
-    -> void {
-    __io_uring_buf_ring_cq_advance(&this->handle, ringBuffer, completionCount, ringBufferCount);
-}
+auto Ring::linkTimeout(io_uring_sqe *const sqe, const __kernel_timespec *const timeout) -> void {
+    if (timeout == nullptr) return;
 
-auto Ring::destroy() noexcept -> void {
-    if (this->handle.ring_fd != -1) io_uring_queue_exit(&this->handle);
+    sqe->flags |= IOSQE_IO_LINK;
+
+    io_uring_sqe *const timeoutSqe{this->getSqe()};
+    io_uring_prep_link_timeout(timeoutSqe, const_cast<__kernel_timespec *>(timeout), 0);
+    io_uring_sqe_set_data64(timeoutSqe, ignoredUserData);
 }
 
 auto Ring::getSqe(const std::source_location sourceLocation) -> io_uring_sqe * {
@@ -1,15 +1,19 @@
 #pragma once
 
-#include <functional>
+#include "Completion.hpp"
+#include "Submission.hpp"
+
+#include <chrono>
+#include <deque>
+#include <limits>
 #include <liburing.h>
 #include <source_location>
 #include <span>
 
-struct Completion;
-struct Submission;
-
 class Ring {
 public:
+    static constexpr unsigned long ignoredUserData{std::numeric_limits<unsigned long>::max()};
+
     Ring(unsigned int entries, io_uring_params &params);
 
     Ring(const Ring &) = delete;
@@ -24,6 +28,8 @@ public:
 
     [[nodiscard]] auto getFileDescriptor() const noexcept -> int;
 
+    [[nodiscard]] auto getFeatures() const noexcept -> unsigned int;
+
     auto registerSelfFileDescriptor(std::source_location sourceLocation = std::source_location::current()) -> void;
 
     auto registerCpu(unsigned int cpuCode, std::source_location sourceLocation = std::source_location::current())
@@ -38,6 +44,9 @@ public:
     auto updateFileDescriptors(unsigned int offset, std::span<const int> fileDescriptors,
                                std::source_location sourceLocation = std::source_location::current()) -> void;
 
+    auto registerBuffers(std::span<const iovec> buffers,
+                         std::source_location sourceLocation = std::source_location::current()) -> void;
+
     [[nodiscard]] auto setupRingBuffer(unsigned int entries, int id,
                                        std::source_location sourceLocation = std::source_location::current())
         -> io_uring_buf_ring *;
@@ -47,16 +56,52 @@ public:
 
     auto submit(const Submission &submission) -> void;
 
+    auto message(int ringFileDescriptor, unsigned long data, unsigned long userData = ignoredUserData) -> void;
+
     auto wait(unsigned int count, std::source_location sourceLocation = std::source_location::current()) -> void;
 
-    [[nodiscard]] auto poll(std::move_only_function<auto(const Completion &completion)->void> &&action) const -> int;
+    auto wait(unsigned int count, std::chrono::microseconds minimumWait,
+              std::source_location sourceLocation = std::source_location::current()) -> void;
+
+    [[nodiscard]] auto spin(std::chrono::microseconds duration,
+                            std::source_location sourceLocation = std::source_location::current()) -> bool;
+
+    template<typename Action>
+    [[nodiscard]] auto poll(Action &&action) const -> int {
+        int count{};
 
-    auto advance(io_uring_buf_ring *ringBuffer, int completionCount, int ringBufferCount) noexcept -> void;
+        unsigned int head;
+        const io_uring_cqe *cqe;
+        io_uring_for_each_cqe(&this->handle, head, cqe) {
+            action(Completion{
+                Outcome{cqe->res, cqe->flags},
+                io_uring_cqe_get_data64(cqe)
+            });
+            ++count;
+        }
+
+        return count;
+    }
+
+    auto advance(int completionCount) noexcept -> void;
 
 private:
+    [[nodiscard]] static auto getSqeCount(const Submission &submission) noexcept -> unsigned int;
+
     auto destroy() noexcept -> void;
 
+    auto prepare(const Submission &submission) -> void;
+
+    [[nodiscard]] auto reserve(unsigned int count) -> bool;
+
+    auto flush(std::source_location sourceLocation = std::source_location::current()) -> void;
+
+    auto drain() -> void;
+
+    auto linkTimeout(io_uring_sqe *sqe, const __kernel_timespec *timeout) -> void;
+
     [[nodiscard]] auto getSqe(std::source_location sourceLocation = std::source_location::current()) -> io_uring_sqe *;
 
     io_uring handle;
+    std::deque<Submission> overflowSubmissions;
 };
@@ -5,11 +5,13 @@
 #include <utility>
 
 RingBuffer::RingBuffer(const std::shared_ptr<Ring> &ring, const unsigned int entries, const int id) :
-    ring{ring}, handle{this->ring->setupRingBuffer(entries, id)}, entries{entries}, id{id} {}
+    ring{ring}, handle{this->ring->setupRingBuffer(entries, id)}, consumedSizes(entries), indexes(entries),
+    entries{entries}, id{id} {}
 
 RingBuffer::RingBuffer(RingBuffer &&other) noexcept :
-    ring{std::move(other.ring)}, handle{std::exchange(other.handle, nullptr)}, entries{other.entries}, id{other.id},
-    offset{other.offset} {}
+    ring{std::move(other.ring)}, handle{std::exchange(other.handle, nullptr)},
+    consumedSizes{std::move(other.consumedSizes)}, indexes{std::move(other.indexes)}, entries{other.entries},
+    head{other.head}, tail{other.tail}, id{other.id}, offset{other.offset} {}
 
 auto RingBuffer::operator=(RingBuffer &&other) noexcept -> RingBuffer & {
     if (this == &other) return *this;
@@ -18,7 +20,11 @@ auto RingBuffer::operator=(RingBuffer &&other) noexcept -> RingBuffer & {
 
     this->ring = std::move(other.ring);
     this->handle = std::exchange(other.handle, nullptr);
+    this->consumedSizes = std::move(other.consumedSizes);
+    this->indexes = std::move(other.indexes);
     this->entries = other.entries;
+    this->head = other.head;
+    this->tail = other.tail;
     this->id = other.id;
     this->offset = other.offset;
 
@@ -32,11 +38,30 @@ auto RingBuffer::getHandle() const noexcept -> io_uring_buf_ring * { return this
 auto RingBuffer::getId() const noexcept -> int { return this->id; }
 
 auto RingBuffer::addBuffer(const std::span<std::byte> buffer, const unsigned short index) noexcept -> void {
+    this->consumedSizes[index] = 0;
+    this->indexes[(this->tail + this->offset) & io_uring_buf_ring_mask(this->entries)] = index;
     io_uring_buf_ring_add(this->handle, buffer.data(), buffer.size(), index, io_uring_buf_ring_mask(this->entries),
                           this->offset++);
 }
 
-auto RingBuffer::getAddedBufferCount() noexcept -> int { return std::exchange(this->offset, 0); }
+auto RingBuffer::getConsumedSize(const unsigned short index) const noexcept -> unsigned int {
+    return this->consumedSizes[index];
+}
+
+auto RingBuffer::consume(const unsigned short index, const unsigned int size) noexcept -> unsigned int {
+    return std::exchange(this->consumedSizes[index], this->consumedSizes[index] + size);
+}
+
+auto RingBuffer::next() noexcept -> unsigned short {
+    return this->indexes[++this->head & io_uring_buf_ring_mask(this->entries)];
+}
+
+auto RingBuffer::advance() noexcept -> int {
+    io_uring_buf_ring_advance(this->handle, this->offset);
+    this->tail += this->offset;
+
+    return std::exchange(this->offset, 0);
+}
 
 auto RingBuffer::destroy() const -> void {
     if (this->handle != nullptr) this->ring->freeRingBuffer(this->handle, this->entries, this->id);
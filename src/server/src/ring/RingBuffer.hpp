@@ -2,6 +2,7 @@
 
 #include <liburing.h>
 #include <memory>
+#include <vector>
 
 class Ring;
 
@@ -25,13 +26,21 @@ public:
 
     auto addBuffer(std::span<std::byte> buffer, unsigned short index) noexcept -> void;
 
-    auto getAddedBufferCount() noexcept -> int;
+    [[nodiscard]] auto getConsumedSize(unsigned short index) const noexcept -> unsigned int;
+
+    [[nodiscard]] auto consume(unsigned short index, unsigned int size) noexcept -> unsigned int;
+
+    [[nodiscard]] auto next() noexcept -> unsigned short;
+
+    auto advance() noexcept -> int;
 
 private:
     auto destroy() const -> void;
 
     std::shared_ptr<Ring> ring;
     io_uring_buf_ring *handle;
-    unsigned int entries;
+    std::vector<unsigned int> consumedSizes;
+    std::vector<unsigned short> indexes;
+    unsigned int entries, head{}, tail{};
     int id, offset{};
 };
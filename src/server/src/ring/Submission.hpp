@@ -1,11 +1,27 @@
 #pragma once
 
+#include <linux/ioprio.h>
+#include <linux/time_types.h>
 #include <span>
 #include <sys/socket.h>
 #include <variant>
 
 struct Submission {
-    enum class Type : unsigned char { write, accept, read, receive, send, truncate, close };
+    static constexpr unsigned short backgroundPriority{IOPRIO_PRIO_VALUE(IOPRIO_CLASS_BE, 7)};
+
+    enum class Type : unsigned char {
+        write,
+        accept,
+        read,
+        receive,
+        send,
+        sendZeroCopy,
+        truncate,
+        close,
+        cancel,
+        message,
+        messageFileDescriptor
+    };
 
     struct Write {
         std::span<const std::byte> buffer;
@@ -30,9 +46,17 @@ struct Submission {
     };
 
     struct Send {
+        std::span<const std::byte> buffer;
+        int flags;
+        const __kernel_timespec *timeout;
+    };
+
+    struct SendZeroCopy {
         std::span<const std::byte> buffer;
         int flags;
         unsigned int zeroCopyFlags;
+        int bufferIndex;
+        const __kernel_timespec *timeout;
     };
 
     struct Truncate {
@@ -41,9 +65,25 @@ struct Submission {
 
     struct Close {};
 
+    struct Cancel {
+        unsigned long userData;
+        int flags;
+    };
+
+    struct Message {
+        unsigned long data;
+    };
+
+    struct MessageFileDescriptor {
+        int sourceFileDescriptor;
+        unsigned long data;
+    };
+
     int fileDescriptor;
     unsigned int flags;
     unsigned short ioPriority;
     unsigned long userData;
-    std::variant<Write, Accept, Read, Receive, Send, Truncate, Close> parameter;
+    std::variant<Write, Accept, Read, Receive, Send, SendZeroCopy, Truncate, Close, Cancel, Message,
+                 MessageFileDescriptor>
+        parameter;
 };
@@ -0,0 +1,60 @@
+#include "Statistics.hpp"
+
+#include <algorithm>
+#include <format>
+
+auto Statistics::get() -> Statistics & {
+    thread_local Statistics statistics;
+
+    return statistics;
+}
+
+auto Statistics::toString() -> std::string {
+    std::string text;
+
+    const std::lock_guard lockGuard{lock};
+
+    for (const Statistics *const instance : instances) {
+        text += std::format("# Scheduler {}\r\n", instance->joinThreadId);
+
+        for (unsigned char i{}; i != instance->counters.size(); ++i)
+            text += std::format("{}:{}\r\n", names[i], instance->counters[i].load(std::memory_order::relaxed));
+    }
+
+    return text;
+}
+
+Statistics::Statistics() {
+    const std::lock_guard lockGuard{lock};
+
+    instances.emplace_back(this);
+}
+
+Statistics::~Statistics() {
+    const std::lock_guard lockGuard{lock};
+
+    std::erase(instances, this);
+}
+
+auto Statistics::add(const Counter counter, const unsigned long value) noexcept -> void {
+    std::atomic_ulong &element{this->counters[std::to_underlying(counter)]};
+
+    element.store(element.load(std::memory_order::relaxed) + value, std::memory_order::relaxed);
+}
+
+auto Statistics::set(const Counter counter, const unsigned long value) noexcept -> void {
+    this->counters[std::to_underlying(counter)].store(value, std::memory_order::relaxed);
+}
+
+auto Statistics::raise(const Counter counter, const unsigned long value) noexcept -> void {
+    if (std::atomic_ulong & element{this->counters[std::to_underlying(counter)]};
+        value > element.load(std::memory_order::relaxed))
+        element.store(value, std::memory_order::relaxed);
+}
+
+auto Statistics::getValue(const Counter counter) const noexcept -> unsigned long {
+    return this->counters[std::to_underlying(counter)].load(std::memory_order::relaxed);
+}
+
+std::mutex Statistics::lock;
+std::vector<const Statistics *> Statistics::instances;
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class Statistics {
+public:
+    enum class Counter : unsigned char {
+        framePoolHit,
+        framePoolMiss,
+        framePoolHighWater,
+        send,
+        sendByte,
+        zeroCopySend,
+        zeroCopySendByte,
+        fixedBufferSend,
+        fixedBufferMiss,
+        receiveBufferExhaustion,
+        receiveBufferReplenish,
+        receiveRearm,
+        receiveBundle,
+        receiveBundleBuffer,
+        queryBufferPeak,
+        outputBufferPeak,
+        querySoftLimitHit,
+        clientPause,
+        clientLimitDisconnect,
+        idleTimeout,
+        sendTimeout,
+        forward,
+        spinHit,
+        spinMiss,
+        idleTime,
+        frame,
+        frameCompletion,
+        frameCompletionPeak,
+        frameTime,
+        frameTimePeak,
+        batchedWait,
+        submissionFlush,
+        submissionOverflow,
+        submissionOverflowPeak,
+        completionOverflow,
+        completionDrop,
+        offload,
+        clientDeferral,
+        shed,
+        persistenceChunk,
+        persistenceByte,
+        persistenceThrottle,
+        activeClient,
+        receiveByteRate,
+        commandRate,
+        migrationOut,
+        migrationIn,
+        migrationAbort,
+        messageFailure,
+        size
+    };
+
+    [[nodiscard]] static auto get() -> Statistics &;
+
+    [[nodiscard]] static auto toString() -> std::string;
+
+    Statistics();
+
+    Statistics(const Statistics &) = delete;
+
+    Statistics(Statistics &&) noexcept = delete;
+
+    auto operator=(const Statistics &) -> Statistics & = delete;
+
+    auto operator=(Statistics &&) noexcept -> Statistics & = delete;
+
+    ~Statistics();
+
+    auto add(Counter counter, unsigned long value = 1) noexcept -> void;
+
+    auto set(Counter counter, unsigned long value) noexcept -> void;
+
+    auto raise(Counter counter, unsigned long value) noexcept -> void;
+
+    [[nodiscard]] auto getValue(Counter counter) const noexcept -> unsigned long;
+
+private:
+    static constexpr std::array<std::string_view, std::to_underlying(Counter::size)> names{
+        "frame_pool_hits",
+        "frame_pool_misses",
+        "frame_pool_high_water",
+        "sends",
+        "send_bytes",
+        "zero_copy_sends",
+        "zero_copy_send_bytes",
+        "fixed_buffer_sends",
+        "fixed_buffer_misses",
+        "receive_buffer_exhaustions",
+        "receive_buffer_replenishes",
+        "receive_rearms",
+        "receive_bundles",
+        "receive_bundle_buffers",
+        "query_buffer_peak",
+        "output_buffer_peak",
+        "query_buffer_soft_limit_hits",
+        "client_pauses",
+        "client_limit_disconnects",
+        "idle_timeouts",
+        "send_timeouts",
+        "forwarded_commands",
+        "spin_hits",
+        "spin_misses",
+        "idle_microseconds",
+        "frames",
+        "frame_completions",
+        "frame_completions_peak",
+        "frame_microseconds",
+        "frame_microseconds_peak",
+        "batched_waits",
+        "submission_queue_flushes",
+        "submission_queue_overflows",
+        "submission_overflow_queue_peak",
+        "completion_queue_overflows",
+        "completion_queue_dropped",
+        "offloaded_commands",
+        "client_deferrals",
+        "shed_commands",
+        "persistence_chunks",
+        "persistence_bytes",
+        "persistence_throttles",
+        "active_clients",
+        "receive_bytes_per_second",
+        "commands_per_second",
+        "migrations_out",
+        "migrations_in",
+        "migration_aborts",
+        "message_failures"};
+
+    static std::mutex lock;
+    static std::vector<const Statistics *> instances;
+
+    std::array<std::atomic_ulong, std::to_underlying(Counter::size)> counters{};
+    std::jthread::id joinThreadId{std::this_thread::get_id()};
+};
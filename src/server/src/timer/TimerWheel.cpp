@@ -0,0 +1,19 @@
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+
+auto TimerWheel::getTime() const noexcept -> unsigned long { return this->time; }
+
+auto TimerWheel::add(Timeout timeout) -> void {
+    timeout.expiration = std::clamp(timeout.expiration, this->time + 1,
+                                    this->time + (1UL << levelCount * slotBit) - 1);
+
+    this->insert(timeout);
+}
+
+auto TimerWheel::insert(const Timeout timeout) -> void {
+    unsigned long level{};
+    while ((timeout.expiration - this->time) >> (level + 1) * slotBit != 0) ++level;
+
+    this->levels[level][getSlot(timeout.expiration, level)].emplace_back(timeout);
+}
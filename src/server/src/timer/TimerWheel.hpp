@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+class TimerWheel {
+public:
+    struct Timeout {
+        unsigned long expiration, clientId;
+        int fileDescriptor;
+    };
+
+    [[nodiscard]] auto getTime() const noexcept -> unsigned long;
+
+    auto add(Timeout timeout) -> void;
+
+    template<typename Action>
+    auto advance(Action &&action) -> void {
+        ++this->time;
+
+        for (unsigned long level{1}; level != levelCount; ++level) {
+            if ((this->time & ((1UL << level * slotBit) - 1)) != 0) break;
+
+            for (const Timeout timeout : std::exchange(this->levels[level][this->getSlot(this->time, level)], {}))
+                this->insert(timeout);
+        }
+
+        for (const Timeout timeout : std::exchange(this->levels[0][this->getSlot(this->time, 0)], {}))
+            action(timeout);
+    }
+
+private:
+    [[nodiscard]] static constexpr auto getSlot(unsigned long time, unsigned long level) noexcept -> unsigned long {
+        return (time >> level * slotBit) & (slotCount - 1);
+    }
+
+    auto insert(Timeout timeout) -> void;
+
+    static constexpr unsigned long levelCount{4}, slotBit{6}, slotCount{1UL << slotBit};
+
+    std::array<std::array<std::vector<Timeout>, slotCount>, levelCount> levels;
+    unsigned long time{};
+};
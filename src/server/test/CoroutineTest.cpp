@@ -0,0 +1,187 @@
+#include "../src/coroutine/AsyncTask.hpp"
+#include "../src/coroutine/Awaiter.hpp"
+#include "../src/coroutine/Channel.hpp"
+#include "../src/coroutine/Event.hpp"
+#include "../src/coroutine/Future.hpp"
+#include "../src/coroutine/Mutex.hpp"
+#include "../src/ring/Ring.hpp"
+#include "Test.hpp"
+
+#include <utility>
+#include <vector>
+
+std::vector<Task> tasks;
+
+auto drain() -> void {
+    std::vector<Task::promise_type *> &readies{Task::promise_type::getReadies()};
+    while (!readies.empty()) {
+        for (const Task::promise_type *const promise : std::exchange(readies, {}))
+            tasks[promise->getIndex()].resume(Outcome{});
+    }
+}
+
+auto start(Task &&task) -> unsigned int {
+    const auto index{static_cast<unsigned int>(tasks.size())};
+    tasks.emplace_back(std::move(task)).setIndex(index);
+    tasks[index].resume(Outcome{});
+    drain();
+
+    return index;
+}
+
+auto waitEvent(Event &event, std::vector<int> &log, const int id) -> AsyncTask<int> {
+    co_await event.wait();
+    log.emplace_back(id);
+
+    co_return id * 10;
+}
+
+auto waitEventTask(Event &event, std::vector<int> &log, const int id) -> Task {
+    log.emplace_back(co_await waitEvent(event, log, id));
+}
+
+auto testEvent() -> void {
+    Event event;
+    std::vector<int> log;
+    const unsigned int first{start(waitEventTask(event, log, 1))}, second{start(waitEventTask(event, log, 2))};
+    expect(log.empty() && !tasks[first].isDone() && !tasks[second].isDone());
+
+    event.set();
+    expect(log.empty());
+    expect(Task::promise_type::getReadies().size() == 2);
+
+    drain();
+    expect((log == std::vector{1, 10, 2, 20}));
+    expect(tasks[first].isDone() && tasks[second].isDone());
+
+    const unsigned int third{start(waitEventTask(event, log, 3))};
+    expect(tasks[third].isDone());
+    expect((log == std::vector{1, 10, 2, 20, 3, 30}));
+}
+
+auto lockMutex(Mutex &mutex, Event &event, std::vector<int> &log, const int id) -> AsyncTask<> {
+    co_await mutex.lock();
+    log.emplace_back(id);
+
+    co_await event.wait();
+    log.emplace_back(-id);
+
+    mutex.unlock();
+}
+
+auto lockMutexTask(Mutex &mutex, Event &event, std::vector<int> &log, const int id) -> Task {
+    co_await lockMutex(mutex, event, log, id);
+}
+
+auto testMutex() -> void {
+    Mutex mutex;
+    Event event;
+    std::vector<int> log;
+    const unsigned int first{start(lockMutexTask(mutex, event, log, 1))},
+        second{start(lockMutexTask(mutex, event, log, 2))};
+    expect((log == std::vector{1}));
+
+    event.set();
+    drain();
+    expect((log == std::vector{1, -1, 2, -2}));
+    expect(tasks[first].isDone() && tasks[second].isDone());
+    expect(mutex.tryLock());
+}
+
+auto receive(Channel<int> &channel, std::vector<int> &log, const int count) -> AsyncTask<> {
+    for (int i{}; i < count; ++i) log.emplace_back(co_await channel.receive());
+}
+
+auto receiveTask(Channel<int> &channel, std::vector<int> &log, const int count) -> Task {
+    co_await receive(channel, log, count);
+}
+
+auto testChannel() -> void {
+    Channel<int> channel;
+    std::vector<int> log;
+    channel.send(1);
+
+    const unsigned int index{start(receiveTask(channel, log, 3))};
+    expect((log == std::vector{1}));
+
+    channel.send(2);
+    expect((log == std::vector{1}));
+
+    drain();
+    expect((log == std::vector{1, 2}));
+
+    channel.send(3);
+    channel.send(4);
+    drain();
+    expect((log == std::vector{1, 2, 3}));
+    expect(tasks[index].isDone());
+}
+
+auto awaitFuture(const Future<int> future, std::vector<int> &log) -> AsyncTask<> { log.emplace_back(co_await future); }
+
+auto awaitTask(const Future<int> future, std::vector<int> &log) -> Task { co_await awaitFuture(future, log); }
+
+auto testFuture() -> void {
+    io_uring_params params{};
+    Ring ring{8, params};
+    std::vector<int> log;
+
+    const Future<int> ready{ring.getFileDescriptor()};
+    ready.set(1, ring);
+    const unsigned int first{start(awaitTask(ready, log))};
+    expect(tasks[first].isDone());
+    expect((log == std::vector{1}));
+
+    const Future<int> pending{ring.getFileDescriptor()};
+    const unsigned int second{start(awaitTask(pending, log))};
+    expect(!tasks[second].isDone());
+
+    pending.set(2, ring);
+    ring.wait(1);
+    ring.advance(ring.poll([](const Completion &completion) {
+        if (completion.userData != Ring::ignoredUserData)
+            tasks[static_cast<unsigned int>(completion.userData)].resume(completion.outcome);
+    }));
+    expect((log == std::vector{1, 2}));
+    expect(tasks[second].isDone());
+}
+
+auto awaitSubmissions(std::vector<int> &log) -> Task {
+    const Submission receive{
+        5, 0, 0, 0, Submission::Receive{{}, 0, 0}
+    };
+    log.emplace_back((co_await Awaiter{receive}).result);
+    log.emplace_back((co_await Awaiter{receive}).result);
+    log.emplace_back((co_await Awaiter{Submission{5, 0, 0, 0, Submission::Close{}}}).result);
+    log.emplace_back((co_await Awaiter{receive}).result);
+}
+
+auto testMultishot() -> void {
+    std::vector<Task::promise_type *> &pendings{Task::promise_type::getPendings()};
+    pendings.clear();
+    std::vector<int> log;
+
+    const unsigned int index{start(awaitSubmissions(log))};
+    expect(pendings.size() == 1);
+
+    tasks[index].resume(Outcome{1, IORING_CQE_F_MORE});
+    expect(pendings.size() == 1);
+
+    tasks[index].resume(Outcome{2, IORING_CQE_F_MORE});
+    expect(pendings.size() == 2);
+
+    tasks[index].resume(Outcome{0, 0});
+    expect(pendings.size() == 3);
+
+    tasks[index].resume(Outcome{3, 0});
+    expect(tasks[index].isDone());
+    expect((log == std::vector{1, 2, 0, 3}));
+}
+
+auto main() -> int {
+    testEvent();
+    testMutex();
+    testChannel();
+    testFuture();
+    testMultishot();
+}
@@ -0,0 +1,223 @@
+#include "../../common/Reply.hpp"
+#include "../src/database/Context.hpp"
+#include "../src/fileDescriptor/DatabaseManager.hpp"
+#include "Test.hpp"
+
+#include <array>
+#include <set>
+#include <string>
+
+auto query(DatabaseManager &databaseManager, Context &context, const std::string_view statement) -> Reply {
+    return databaseManager.query(context, Answer{statement});
+}
+
+auto relay(DatabaseManager &databaseManager, Context &context, const std::string_view statement) -> Reply {
+    Answer answer{statement};
+    const long shard{databaseManager.route(context, answer)};
+    if (shard != DatabaseManager::manyShards) return databaseManager.query(context, std::move(answer), shard);
+
+    std::vector parts{databaseManager.scatter(context, answer)};
+    std::vector<Reply> replies;
+    for (DatabaseManager::Part &part : parts)
+        replies.emplace_back(databaseManager.query(context, std::move(part.answer), part.shard));
+
+    return databaseManager.gather(context, answer, parts, std::move(replies));
+}
+
+auto testShards() -> void {
+    DatabaseManager databaseManager{-1, 4, 128, 64};
+    Context context;
+
+    expect(query(databaseManager, context, "DBSIZE").getInteger() == 0);
+    expect(query(databaseManager, context, "RANDOMKEY").getType() == Reply::Type::nil);
+
+    std::set<std::string> keys;
+    for (unsigned long i{}; i != 64; ++i) {
+        const std::string key{"key:" + std::to_string(i)};
+        static_cast<void>(query(databaseManager, context, "SET " + key + " value"));
+        keys.emplace(key);
+
+        expect(query(databaseManager, context, "DBSIZE").getInteger() == static_cast<long>(keys.size()));
+    }
+
+    std::set<std::string> seen;
+    for (unsigned long i{}; i != 10000; ++i) {
+        const Reply reply{query(databaseManager, context, "RANDOMKEY")};
+        expect(reply.getType() == Reply::Type::string);
+        expect(keys.contains(std::string{reply.getString()}));
+
+        seen.emplace(reply.getString());
+    }
+    expect(seen == keys);
+
+    static_cast<void>(query(databaseManager, context, "SELECT 1"));
+    expect(query(databaseManager, context, "DBSIZE").getInteger() == 0);
+    expect(query(databaseManager, context, "RANDOMKEY").getType() == Reply::Type::nil);
+    static_cast<void>(query(databaseManager, context, "SELECT 0"));
+
+    for (unsigned long i{}; i != 64; i += 2) {
+        const std::string key{"key:" + std::to_string(i)};
+        static_cast<void>(query(databaseManager, context, "DEL " + key));
+        keys.erase(key);
+    }
+    expect(query(databaseManager, context, "DBSIZE").getInteger() == static_cast<long>(keys.size()));
+    for (unsigned long i{}; i != 1000; ++i)
+        expect(keys.contains(std::string{query(databaseManager, context, "RANDOMKEY").getString()}));
+
+    static_cast<void>(query(databaseManager, context, "FLUSHDB"));
+    expect(query(databaseManager, context, "DBSIZE").getInteger() == 0);
+    expect(query(databaseManager, context, "RANDOMKEY").getType() == Reply::Type::nil);
+}
+
+auto testRelay() -> void {
+    DatabaseManager databaseManager{-1, 4, 128, 64};
+    Context context;
+
+    std::string set{"MSET"}, get{"MGET"};
+    for (unsigned long i{}; i != 16; ++i) {
+        set += " key:" + std::to_string(i) + " " + std::to_string(i);
+        get += " key:" + std::to_string(i);
+    }
+    expect(databaseManager.route(context, Answer{std::string_view{set}}) == DatabaseManager::manyShards);
+    expect(relay(databaseManager, context, set).getString() == "OK");
+
+    const Reply values{relay(databaseManager, context, get + " missing")};
+    expect(values.getArray().size() == 17);
+    for (unsigned long i{}; i != 16; ++i) expect(values.getArray()[i].getString() == std::to_string(i));
+    expect(values.getArray()[16].getType() == Reply::Type::nil);
+
+    expect(relay(databaseManager, context, "DBSIZE").getInteger() == 16);
+    expect(relay(databaseManager, context, "EXISTS key:0 key:1 key:2 missing").getInteger() == 3);
+    expect(relay(databaseManager, context, "DEL key:0 key:1 key:2 missing").getInteger() == 3);
+    expect(relay(databaseManager, context, "DBSIZE").getInteger() == 13);
+    for (unsigned long i{}; i != 100; ++i)
+        expect(relay(databaseManager, context, "RANDOMKEY").getString().starts_with("key:"));
+
+    const long shard{databaseManager.route(context, Answer{std::string_view{"GET key:3"}})};
+    std::string other{"other:0"};
+    for (unsigned long i{1}; databaseManager.route(context, Answer{"GET " + other}) == shard; ++i)
+        other = "other:" + std::to_string(i);
+    expect(databaseManager.route(context, Answer{std::string_view{"PING"}}) == DatabaseManager::anyShard);
+
+    static_cast<void>(relay(databaseManager, context, "MULTI"));
+    static_cast<void>(relay(databaseManager, context, "SET key:3 three"));
+    expect(databaseManager.route(context, Answer{std::string_view{"EXEC"}}) == shard);
+    static_cast<void>(relay(databaseManager, context, "SET " + other + " other"));
+    expect(databaseManager.route(context, Answer{std::string_view{"EXEC"}}) == DatabaseManager::manyShards);
+    const Reply replies{relay(databaseManager, context, "EXEC")};
+    expect(replies.getArray().size() == 2);
+    expect(!context.getIsTransaction());
+    expect(relay(databaseManager, context, "MGET key:3 " + other).getArray()[1].getString() == "other");
+
+    static_cast<void>(relay(databaseManager, context, "MULTI"));
+    static_cast<void>(relay(databaseManager, context, "DBSIZE"));
+    expect(relay(databaseManager, context, "EXEC").getType() == Reply::Type::error);
+    expect(!context.getIsTransaction());
+
+    expect(relay(databaseManager, context, "FLUSHDB").getString() == "OK");
+    expect(relay(databaseManager, context, "DBSIZE").getInteger() == 0);
+    expect(relay(databaseManager, context, "RANDOMKEY").getType() == Reply::Type::nil);
+}
+
+auto testArguments() -> void {
+    DatabaseManager databaseManager{-1, 1, 128, 64};
+    Context context;
+
+    constexpr std::array<std::string_view, 3> arguments{"set", "key", "hello world"};
+    expect(databaseManager.query(context, Answer{arguments}).getString() == "OK");
+    expect(query(databaseManager, context, "get key").getString() == "hello world");
+
+    expect(query(databaseManager, context, "GET").getType() == Reply::Type::error);
+    expect(query(databaseManager, context, "HSET hash field").getType() == Reply::Type::error);
+    expect(query(databaseManager, context, "object encoding key").getString() == "embstr");
+}
+
+auto testRename() -> void {
+    DatabaseManager databaseManager{-1, 1, 128, 64};
+    Context context;
+
+    static_cast<void>(query(databaseManager, context, "SET key value"));
+    expect(query(databaseManager, context, "RENAME key other").getString() == "OK");
+    expect(query(databaseManager, context, "GET key").getType() == Reply::Type::nil);
+    expect(query(databaseManager, context, "GET other").getString() == "value");
+
+    static_cast<void>(query(databaseManager, context, "SET key value"));
+    expect(query(databaseManager, context, "RENAMENX key other").getInteger() == 0);
+    expect(query(databaseManager, context, "RENAMENX key third").getInteger() == 1);
+
+    expect(query(databaseManager, context, "MOVE third 1").getInteger() == 1);
+    expect(query(databaseManager, context, "MOVE other 1").getInteger() == 1);
+    expect(query(databaseManager, context, "DBSIZE").getInteger() == 0);
+
+    static_cast<void>(query(databaseManager, context, "SELECT 1"));
+    expect(query(databaseManager, context, "GET third").getString() == "value");
+    expect(query(databaseManager, context, "GET other").getString() == "value");
+}
+
+auto testClient() -> void {
+    DatabaseManager databaseManager{-1, 1, 128, 64};
+    Context context;
+
+    expect(query(databaseManager, context, "CLIENT LIST").getType() == Reply::Type::error);
+
+    DatabaseManager::setClientHandler([](const std::span<const std::string_view> arguments) {
+        return Reply{Reply::Type::string, std::string{arguments[0]}};
+    });
+
+    expect(query(databaseManager, context, "client list").getString() == "list");
+
+    static_cast<void>(query(databaseManager, context, "MULTI"));
+    expect(query(databaseManager, context, "CLIENT LIST").getString() == "QUEUED");
+    static_cast<void>(query(databaseManager, context, "SET key value"));
+
+    const Reply reply{query(databaseManager, context, "EXEC")};
+    expect(reply.getArray().size() == 2);
+    expect(reply.getArray()[0].getString() == "LIST");
+    expect(reply.getArray()[1].getString() == "OK");
+
+    DatabaseManager::setClientHandler({});
+}
+
+auto testPersistence() -> void {
+    for (const unsigned long shardCount : {1UL, 4UL}) {
+        DatabaseManager databaseManager{-1, shardCount, 128, 64};
+        Context context;
+
+        expect(!databaseManager.isWritable());
+        for (unsigned long i{}; i != 16; ++i)
+            static_cast<void>(query(databaseManager, context, "SET key:" + std::to_string(i) + " value"));
+        static_cast<void>(query(databaseManager, context, "GET key:0"));
+        expect(databaseManager.isWritable());
+        expect(!databaseManager.isCanTruncate());
+        databaseManager.wrote();
+
+        for (unsigned long second{3}; second != 300; ++second) expect(!databaseManager.isWritable());
+        expect(databaseManager.isWritable() == (shardCount == 1));
+        if (shardCount != 1) {
+            static_cast<void>(query(databaseManager, context, "SET key:0 other"));
+            for (unsigned long shard{}; shard != shardCount; ++shard) {
+                expect(!databaseManager.isWritable());
+                databaseManager.snapshot(shard);
+                databaseManager.snapshot(shard);
+            }
+            expect(databaseManager.isWritable());
+        }
+        expect(databaseManager.isCanTruncate());
+        databaseManager.wrote();
+
+        expect(!databaseManager.isWritable());
+        static_cast<void>(query(databaseManager, context, "SET key:0 value"));
+        expect(databaseManager.isWritable());
+        expect(!databaseManager.isCanTruncate());
+        databaseManager.wrote();
+    }
+}
+
+auto main() -> int {
+    testShards();
+    testRelay();
+    testArguments();
+    testRename();
+    testClient();
+    testPersistence();
+}
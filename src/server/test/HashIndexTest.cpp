@@ -0,0 +1,127 @@
+#include "../src/database/HashIndex.hpp"
+#include "Test.hpp"
+
+#include <string>
+#include <unordered_set>
+
+auto getKey(const unsigned long index) -> std::string { return "key:" + std::to_string(index); }
+
+auto testGrowth() -> void {
+    HashIndex hashIndex;
+    for (unsigned long i{}; i != 2000; ++i) {
+        hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+        expect(hashIndex.getSize() == i + 1);
+
+        for (unsigned long j{}; j <= i; ++j) {
+            const Entry *const entry{hashIndex.find(getKey(j))};
+            expect(entry && entry->getKey() == getKey(j));
+        }
+        expect(hashIndex.find(getKey(i + 1)) == nullptr);
+    }
+}
+
+auto testOverwrite() -> void {
+    HashIndex hashIndex;
+    for (unsigned long i{}; i != 1000; ++i) hashIndex.insert(Entry::create(getKey(i), "old"));
+
+    for (unsigned long i{}; i != 1000; ++i) {
+        const IntrusivePointer entry{Entry::create(getKey(i), "new")};
+        hashIndex.insert(entry);
+
+        expect(hashIndex.getSize() == 1000);
+        expect(hashIndex.find(getKey(i)) == entry.get());
+    }
+}
+
+auto testErase() -> void {
+    HashIndex hashIndex;
+    for (unsigned long i{}; i != 1000; ++i) hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+
+    for (unsigned long i{}; i != 1000; i += 2) expect(hashIndex.erase(getKey(i)));
+    for (unsigned long i{}; i != 1000; i += 2) expect(!hashIndex.erase(getKey(i)));
+    expect(hashIndex.getSize() == 500);
+
+    for (unsigned long i{}; i != 1000; ++i) expect((hashIndex.find(getKey(i)) == nullptr) == (i % 2 == 0));
+
+    const Entry *const entry{hashIndex.find(getKey(1))};
+    const IntrusivePointer extracted{hashIndex.extract(getKey(1))};
+    expect(extracted.get() == entry && extracted->getKey() == getKey(1));
+    expect(hashIndex.getSize() == 499 && hashIndex.find(getKey(1)) == nullptr);
+    expect(hashIndex.extract(getKey(1)) == nullptr);
+}
+
+auto testTombstoneReuse() -> void {
+    HashIndex hashIndex;
+    std::unordered_set<unsigned long> live;
+    for (unsigned long i{}; i != 100; ++i) {
+        hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+        live.emplace(i);
+    }
+
+    for (unsigned long i{}; i != 100000; ++i) {
+        expect(hashIndex.erase(getKey(i)));
+        live.erase(i);
+
+        hashIndex.insert(Entry::create(getKey(i + 100), std::to_string(i + 100)));
+        live.emplace(i + 100);
+
+        expect(hashIndex.getSize() == 100);
+        expect(hashIndex.find(getKey(i)) == nullptr);
+        if (i % 1000 == 0) {
+            for (const unsigned long index : live) expect(hashIndex.find(getKey(index)) != nullptr);
+        }
+    }
+}
+
+auto testClear() -> void {
+    HashIndex hashIndex;
+    for (unsigned long i{}; i != 897; ++i) hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+
+    hashIndex.clear();
+    expect(hashIndex.getSize() == 0);
+    for (unsigned long i{}; i != 897; ++i) expect(hashIndex.find(getKey(i)) == nullptr);
+    expect(!hashIndex.erase(getKey(0)));
+
+    for (unsigned long i{}; i != 100; ++i) hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+    expect(hashIndex.getSize() == 100);
+    for (unsigned long i{}; i != 100; ++i) expect(hashIndex.find(getKey(i)) != nullptr);
+}
+
+auto testForEach() -> void {
+    HashIndex hashIndex;
+    for (unsigned long i{}; i != 1000; ++i) hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+    for (unsigned long i{}; i < 1000; i += 3) expect(hashIndex.erase(getKey(i)));
+
+    std::unordered_set<std::string> keys;
+    hashIndex.forEach([&keys](const Entry &entry) { expect(keys.emplace(entry.getKey()).second); });
+
+    expect(keys.size() == hashIndex.getSize());
+    for (unsigned long i{}; i != 1000; ++i) expect(keys.contains(getKey(i)) == (i % 3 != 0));
+}
+
+auto testSample() -> void {
+    HashIndex hashIndex;
+    expect(hashIndex.sample(0) == nullptr);
+
+    for (unsigned long i{}; i != 100; ++i) hashIndex.insert(Entry::create(getKey(i), std::to_string(i)));
+    for (unsigned long i{}; i != 90; ++i) expect(hashIndex.erase(getKey(i)));
+
+    std::unordered_set<std::string> keys;
+    for (unsigned long i{}; i != 10000; ++i) {
+        const Entry *const entry{hashIndex.sample(i)};
+        expect(entry != nullptr && hashIndex.find(entry->getKey()) != nullptr);
+
+        keys.emplace(entry->getKey());
+    }
+    expect(keys.size() == 10);
+}
+
+auto main() -> int {
+    testGrowth();
+    testOverwrite();
+    testErase();
+    testTombstoneReuse();
+    testClear();
+    testForEach();
+    testSample();
+}
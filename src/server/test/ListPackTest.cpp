@@ -0,0 +1,164 @@
+#include "../src/database/Entry.hpp"
+#include "../src/database/ListPack.hpp"
+#include "Test.hpp"
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+auto getValue(const unsigned long index) -> std::string {
+    return std::string(index % 300, static_cast<char>('a' + index % 26));
+}
+
+auto check(const ListPack &listPack, const std::vector<std::string> &expected) -> void {
+    expect(listPack.getCount() == expected.size());
+
+    ListPack::Iterator iterator{listPack.begin()};
+    for (const std::string &value : expected) {
+        expect(iterator != listPack.end() && *iterator == value);
+        ++iterator;
+    }
+    expect(iterator == listPack.end());
+}
+
+auto testGrowth() -> void {
+    ListPack listPack;
+    std::vector<std::string> expected;
+
+    for (unsigned long i{}; i != 1000; ++i) {
+        const std::string value{getValue(i)};
+        if (i % 3 == 0) {
+            listPack.insert(listPack.begin(), value);
+            expected.insert(expected.begin(), value);
+        } else {
+            listPack.insert(listPack.end(), value);
+            expected.push_back(value);
+        }
+
+        check(listPack, expected);
+    }
+
+    ListPack moved{std::move(listPack)};
+    check(moved, expected);
+}
+
+auto testReplace() -> void {
+    ListPack listPack;
+    std::vector<std::string> expected;
+    for (unsigned long i{}; i != 10; ++i) {
+        expected.push_back(std::to_string(i));
+        listPack.insert(listPack.end(), expected.back());
+    }
+
+    const auto replace{[&](const unsigned long index, const std::string &value) {
+        ListPack::Iterator iterator{listPack.begin()};
+        for (unsigned long i{}; i != index; ++i) ++iterator;
+
+        listPack.replace(iterator, value);
+        expected[index] = value;
+        check(listPack, expected);
+    }};
+
+    replace(5, std::string(200, 'x'));
+    replace(5, "y");
+    replace(0, std::string(1000, 'z'));
+    replace(9, "");
+    replace(0, "first");
+}
+
+auto testErase() -> void {
+    ListPack listPack;
+    std::vector<std::string> expected;
+    for (unsigned long i{}; i != 20; ++i) {
+        expected.push_back(getValue(i * 17));
+        listPack.insert(listPack.end(), expected.back());
+    }
+
+    ListPack::Iterator iterator{listPack.begin()};
+    for (unsigned long i{}; i != 4; ++i) ++iterator;
+    listPack.erase(iterator, 6);
+    expected.erase(expected.begin() + 4, expected.begin() + 10);
+    check(listPack, expected);
+
+    listPack.erase(listPack.begin(), 2);
+    expected.erase(expected.begin(), expected.begin() + 2);
+    check(listPack, expected);
+
+    listPack.erase(listPack.begin(), expected.size());
+    check(listPack, {});
+}
+
+auto testFind() -> void {
+    ListPack listPack;
+    for (const std::string_view value : {"a", "b", "b", "c", "c", "a"}) listPack.insert(listPack.end(), value);
+
+    expect(*++listPack.find("b", 2) == "c");
+    expect(*++listPack.find("c", 2) == "a");
+    expect(listPack.find("a", 2) == listPack.begin());
+    expect(listPack.find("d") == listPack.end());
+}
+
+auto testHashConversion() -> void {
+    Entry::setListPackLimit(8, 16);
+
+    IntrusivePointer entry{Entry::create("hash", std::unordered_map<std::string, std::string>{})};
+    for (unsigned long i{}; i != 8; ++i) {
+        expect(entry->setField("field:" + std::to_string(i), std::to_string(i)));
+        expect(entry->getEncoding() == Entry::Encoding::listPack);
+    }
+    expect(!entry->setField("field:0", std::string(16, 'v')));
+    expect(entry->getEncoding() == Entry::Encoding::listPack);
+
+    expect(entry->setField("field:8", "8"));
+    expect(entry->getEncoding() == Entry::Encoding::hashTable);
+    expect(entry->getSize() == 9);
+    expect(entry->getField("field:0") == std::string(16, 'v'));
+    for (unsigned long i{1}; i != 9; ++i) expect(entry->getField("field:" + std::to_string(i)) == std::to_string(i));
+
+    entry = Entry::create("hash", std::unordered_map<std::string, std::string>{{"a", "1"}, {"b", "2"}});
+    expect(entry->getEncoding() == Entry::Encoding::listPack);
+    expect(!entry->setField("a", std::string(17, 'v')));
+    expect(entry->getEncoding() == Entry::Encoding::hashTable);
+    expect(entry->getField("a") == std::string(17, 'v'));
+    expect(entry->getField("b") == "2");
+
+    entry = Entry::create("hash", std::unordered_map<std::string, std::string>{{std::string(17, 'f'), "1"}});
+    expect(entry->getEncoding() == Entry::Encoding::hashTable);
+}
+
+auto testListConversion() -> void {
+    Entry::setListPackLimit(8, 16);
+
+    IntrusivePointer entry{Entry::create("list", std::deque<std::string>{})};
+    for (unsigned long i{}; i != 8; ++i) {
+        entry->pushFront(std::to_string(i));
+        expect(entry->getEncoding() == Entry::Encoding::listPack);
+    }
+
+    entry->pushFront("8");
+    expect(entry->getEncoding() == Entry::Encoding::quickList);
+    expect(entry->getSize() == 9);
+    for (unsigned long i{}; i != 9; ++i) expect(entry->getElement(i) == std::to_string(8 - i));
+
+    entry = Entry::create("list", std::deque<std::string>{"a", "b"});
+    expect(entry->getEncoding() == Entry::Encoding::listPack);
+    entry->pushFront(std::string(17, 'v'));
+    expect(entry->getEncoding() == Entry::Encoding::quickList);
+    expect(entry->popFront() == std::string(17, 'v'));
+    expect(entry->popFront() == "a");
+    expect(entry->popFront() == "b");
+    expect(!entry->popFront());
+
+    entry = Entry::create("list", std::deque<std::string>(9, "v"));
+    expect(entry->getEncoding() == Entry::Encoding::quickList);
+}
+
+auto main() -> int {
+    testGrowth();
+    testReplace();
+    testErase();
+    testFind();
+    testHashConversion();
+    testListConversion();
+}
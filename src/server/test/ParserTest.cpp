@@ -0,0 +1,148 @@
+#include "../src/protocol/Parser.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+auto append(Parser &parser, const std::string_view text) -> void {
+    parser.append(std::span{reinterpret_cast<const std::byte *>(text.data()), text.size()});
+}
+
+auto isEqual(const std::optional<Answer> &answer, const std::initializer_list<std::string_view> arguments) -> bool {
+    return answer && answer->getCommand() == *arguments.begin() &&
+           std::ranges::equal(answer->getArguments(), std::span{arguments}.subspan(1));
+}
+
+auto testSplitFrame() -> void {
+    Parser parser;
+    constexpr std::string_view frame{"*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\nvalue\r\n"};
+    for (unsigned long i{}; i < frame.size() - 1; ++i) {
+        append(parser, frame.substr(i, 1));
+        expect(!parser.parse());
+        expect(parser.takeError().empty());
+        parser.compact();
+    }
+
+    append(parser, frame.substr(frame.size() - 1));
+    const std::optional answer{parser.parse()};
+    expect(isEqual(answer, {"SET", "key", "value"}));
+    expect(parser.getSize() == 0);
+}
+
+auto testPipeline() -> void {
+    Parser parser;
+    append(parser, "*1\r\n$4\r\nPING\r\n*2\r\n$3\r\nGET\r\n$3\r\nkey\r\nPING\r\n");
+
+    std::optional answer{parser.parse()};
+    expect(isEqual(answer, {"PING"}));
+    answer = parser.parse();
+    expect(isEqual(answer, {"GET", "key"}));
+    answer = parser.parse();
+    expect(isEqual(answer, {"PING"}));
+    expect(!parser.parse());
+}
+
+auto testEmbeddedSpace() -> void {
+    Parser parser;
+    append(parser, "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$11\r\nhello world\r\n*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n");
+
+    std::optional answer{parser.parse()};
+    expect(isEqual(answer, {"SET", "key", "hello world"}));
+    expect(parser.takeError().empty());
+
+    answer = parser.parse();
+    expect(isEqual(answer, {"GET", "key"}));
+}
+
+auto testLowercase() -> void {
+    Parser parser;
+    append(parser, "*2\r\n$3\r\nget\r\n$3\r\nKey\r\nping hello\r\n");
+
+    std::optional answer{parser.parse()};
+    expect(isEqual(answer, {"GET", "Key"}));
+    answer = parser.parse();
+    expect(isEqual(answer, {"PING", "hello"}));
+}
+
+auto testGarbage() -> void {
+    for (const std::string_view frame :
+         {"*x\r\n", "*1\r\nGET\r\n", "*1\r\n$-1\r\n", "*1\r\n$abc\r\n", "*1\r\n$3\r\nGETXX"}) {
+        Parser parser;
+        append(parser, frame);
+
+        expect(!parser.parse());
+        expect(parser.takeError().starts_with("ERR Protocol error"));
+        expect(parser.getIsInvalid());
+
+        append(parser, "*1\r\n$4\r\nPING\r\n");
+        expect(!parser.parse());
+        expect(parser.getSize() == 0);
+    }
+}
+
+auto testIncomplete() -> void {
+    Parser parser;
+    append(parser, "*2\r\n$3\r\nGET\r\n$3\r\nke");
+
+    expect(!parser.parse());
+    expect(parser.takeError().empty());
+    expect(!parser.getIsInvalid());
+}
+
+auto testNativeFrames() -> void {
+    std::vector<std::byte> frames;
+    for (const std::string_view statement : {"SET key value", "GET key", "DEL key"}) {
+        const std::vector frame{Answer{statement}.serialize()};
+        frames.insert(frames.cend(), frame.cbegin(), frame.cend());
+    }
+
+    Parser parser;
+    parser.append(std::span{frames}.first(5));
+    expect(!parser.parse());
+    parser.compact();
+
+    parser.append(std::span{frames}.subspan(5, 40));
+    std::optional answer{parser.parse()};
+    expect(parser.getProtocol() == Parser::Protocol::native);
+    expect(isEqual(answer, {"SET", "key", "value"}));
+    expect(!parser.parse());
+    parser.compact();
+
+    parser.append(std::span{frames}.subspan(45));
+    answer = parser.parse();
+    expect(isEqual(answer, {"GET", "key"}));
+    answer = parser.parse();
+    expect(isEqual(answer, {"DEL", "key"}));
+    expect(!parser.parse());
+    expect(parser.getSize() == 0);
+}
+
+auto testNativeNewlineSize() -> void {
+    const std::string value(238, 'v');
+    const std::vector frame{Answer{"SET a " + value}.serialize()};
+    expect(frame.front() == std::byte{'\n'});
+
+    Parser parser;
+    for (unsigned long i{}; i != frame.size() - 1; ++i) {
+        parser.append(std::span{frame}.subspan(i, 1));
+        expect(!parser.parse());
+        parser.compact();
+    }
+
+    parser.append(std::span{frame}.last(1));
+    const std::optional answer{parser.parse()};
+    expect(parser.getProtocol() == Parser::Protocol::native);
+    expect(isEqual(answer, {"SET", "a", value}));
+}
+
+auto main() -> int {
+    testSplitFrame();
+    testPipeline();
+    testEmbeddedSpace();
+    testLowercase();
+    testGarbage();
+    testIncomplete();
+    testNativeFrames();
+    testNativeNewlineSize();
+}
@@ -0,0 +1,31 @@
+#include "../src/ring/Ring.hpp"
+#include "../src/statistics/Statistics.hpp"
+#include "Test.hpp"
+
+auto testOverflowDrain() -> void {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_SQPOLL | IORING_SETUP_CQSIZE;
+    params.sq_thread_idle = 1000;
+    params.cq_entries = 1U << 16;
+    Ring ring{4, params};
+
+    const Statistics &statistics{Statistics::get()};
+    unsigned long sent{}, received{};
+    for (unsigned long burst{64}; statistics.getValue(Statistics::Counter::submissionOverflow) == 0; burst *= 2) {
+        expect(burst <= params.cq_entries);
+
+        for (unsigned long i{}; i != burst; ++i) ring.message(ring.getFileDescriptor(), sent++);
+
+        while (received != sent) {
+            ring.wait(1);
+            ring.advance(ring.poll([&received](const Completion completion) {
+                expect(completion.outcome.result == 0);
+                expect(completion.userData == received++);
+            }));
+        }
+    }
+
+    expect(statistics.getValue(Statistics::Counter::submissionOverflowPeak) != 0);
+}
+
+auto main() -> int { testOverflowDrain(); }
@@ -0,0 +1,96 @@
+#include "../src/database/Entry.hpp"
+#include "../src/database/SkipList.hpp"
+#include "Test.hpp"
+
+#include <random>
+#include <set>
+#include <string>
+
+auto expectConsistent(const SkipList &skipList, const std::set<std::string> &reference) -> void {
+    expect(skipList.getSize() == reference.size());
+
+    for (unsigned long rank{}; const std::string &key : reference) {
+        const IntrusivePointer entry{skipList.select(rank)};
+        expect(entry && entry->getKey() == key);
+        expect(skipList.getRank(key) == rank);
+
+        ++rank;
+    }
+    expect(skipList.select(reference.size()) == nullptr);
+}
+
+auto getKey(std::mt19937_64 &generator) -> std::string {
+    switch (const unsigned long random{generator() % 1000}; generator() % 3) {
+        case 0:
+            return std::to_string(random);
+        case 1:
+            return "shared:prefix:" + std::to_string(random);
+        default:
+            return std::string(random % 12, 'k') + std::string{'\0'} + std::to_string(random);
+    }
+}
+
+auto testRandomized() -> void {
+    SkipList skipList;
+    std::set<std::string> reference;
+    std::mt19937_64 generator{1};
+    for (unsigned long i{}; i != 20000; ++i) {
+        const std::string key{getKey(generator)};
+        if (generator() % 3 != 0) {
+            skipList.insert(Entry::create(key, "value"));
+            reference.emplace(key);
+        } else expect(skipList.erase(key) == (reference.erase(key) == 1));
+
+        expect(skipList.getSize() == reference.size());
+        if (i % 500 == 0) expectConsistent(skipList, reference);
+    }
+
+    expectConsistent(skipList, reference);
+    expect(!skipList.getRank("missing"));
+}
+
+auto testReplace() -> void {
+    SkipList skipList;
+    for (const char *const key : {"b", "a", "c"}) skipList.insert(Entry::create(key, "old"));
+
+    const IntrusivePointer entry{Entry::create("b", "new")};
+    skipList.insert(entry);
+
+    expect(skipList.getSize() == 3);
+    expect(skipList.select(1).get() == entry.get());
+    expect(skipList.getRank("b") == 1);
+}
+
+auto testEdges() -> void {
+    SkipList skipList;
+    expect(skipList.select(0) == nullptr);
+    expect(!skipList.getRank("a"));
+    expect(!skipList.erase("a"));
+
+    std::set<std::string> reference;
+    for (unsigned long i{}; i != 1000; ++i) {
+        const std::string key{std::to_string(1000 + i)};
+        skipList.insert(Entry::create(key, "value"));
+        reference.emplace(key);
+    }
+    expectConsistent(skipList, reference);
+
+    for (unsigned long i{}; i < 1000; i += 3) {
+        expect(skipList.erase(std::to_string(1000 + i)));
+        reference.erase(std::to_string(1000 + i));
+    }
+    expectConsistent(skipList, reference);
+
+    skipList.clear();
+    expect(skipList.getSize() == 0);
+    expect(skipList.select(0) == nullptr);
+
+    skipList.insert(Entry::create("a", "value"));
+    expect(skipList.getRank("a") == 0);
+}
+
+auto main() -> int {
+    testRandomized();
+    testReplace();
+    testEdges();
+}
@@ -0,0 +1,59 @@
+#include "../src/timer/TimerWheel.hpp"
+#include "Test.hpp"
+
+#include <array>
+#include <map>
+
+auto run(TimerWheel &timerWheel, const unsigned long until) -> std::map<unsigned long, unsigned long> {
+    std::map<unsigned long, unsigned long> expirations;
+    while (timerWheel.getTime() != until) {
+        timerWheel.advance([&](const TimerWheel::Timeout timeout) {
+            expect(expirations.emplace(timeout.clientId, timerWheel.getTime()).second);
+        });
+    }
+
+    return expirations;
+}
+
+auto testExpiry() -> void {
+    TimerWheel timerWheel;
+    constexpr std::array<unsigned long, 12> expirations{1, 2, 63, 64, 65, 100, 4095, 4096, 4097, 5000, 262144, 300000};
+    for (unsigned long i{}; i != expirations.size(); ++i)
+        timerWheel.add(TimerWheel::Timeout{expirations[i], i, static_cast<int>(i)});
+
+    const std::map fired{run(timerWheel, expirations.back() + 1)};
+    expect(fired.size() == expirations.size());
+    for (unsigned long i{}; i != expirations.size(); ++i) expect(fired.at(i) == expirations[i]);
+}
+
+auto testRelative() -> void {
+    TimerWheel timerWheel;
+    static_cast<void>(run(timerWheel, 1000));
+
+    timerWheel.add(TimerWheel::Timeout{1000 + 70, 0, 0});
+    timerWheel.add(TimerWheel::Timeout{1000 + 5000, 1, 1});
+    timerWheel.add(TimerWheel::Timeout{1000, 2, 2});
+    timerWheel.add(TimerWheel::Timeout{10, 3, 3});
+
+    const std::map fired{run(timerWheel, 7000)};
+    expect(fired.size() == 4);
+    expect(fired.at(0) == 1070);
+    expect(fired.at(1) == 6000);
+    expect(fired.at(2) == 1001);
+    expect(fired.at(3) == 1001);
+}
+
+auto testClamp() -> void {
+    TimerWheel timerWheel;
+    timerWheel.add(TimerWheel::Timeout{1UL << 40, 0, 0});
+
+    const std::map fired{run(timerWheel, 1UL << 24)};
+    expect(fired.size() == 1);
+    expect(fired.at(0) == (1UL << 24) - 1);
+}
+
+auto main() -> int {
+    testExpiry();
+    testRelative();
+    testClamp();
+}